@@ -19,6 +19,24 @@ void benchAdd(benchmark::State& state) {
     }
 }
 
+// Limbs of mixed magnitude, so carries are neither always generated nor always absorbed.
+void benchAddLong(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    std::vector<Chunk> lhsLimbs(range);
+    std::vector<Chunk> rhsLimbs(range);
+    for (size_t i = 0; i < range; ++i) {
+        lhsLimbs[i] = (i * 0x9E3779B97F4A7C15ULL) % (MAX_VALUE + 1);
+        rhsLimbs[i] = MAX_VALUE - ((i * 0xC2B2AE3D27D4EB4FULL) % (MAX_VALUE + 1));
+    }
+
+    BigUInt lhs = createTestBigUInt(lhsLimbs);
+    BigUInt rhs = createTestBigUInt(rhsLimbs);
+
+    for (auto iter : state) {
+        benchmark::DoNotOptimize(add(lhs, rhs));
+    }
+}
+
 void benchSub(benchmark::State& state) {
     auto range = static_cast<size_t>(state.range(0));
     std::vector<Chunk> limbs(range, INT64_MAX);
@@ -30,7 +48,70 @@ void benchSub(benchmark::State& state) {
         sub(lhs, rhs);
     }
 }
+
+void benchAddInPlace(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    std::vector<Chunk> limbs(range, INT64_MAX);
+
+    BigUInt total = createTestBigUInt(limbs);
+    BigUInt addend = createTestBigUInt(limbs);
+
+    for (auto iter : state) {
+        total += addend;
+        benchmark::DoNotOptimize(total);
+    }
+}
+
+void benchSubInPlace(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    std::vector<Chunk> limbs(range, INT64_MAX);
+    limbs.push_back(INT64_MAX);
+
+    BigUInt total = createTestBigUInt(limbs);
+    BigUInt subtrahend = createTestBigUInt(std::vector<Chunk>(range, 1));
+
+    for (auto iter : state) {
+        total -= subtrahend;
+        benchmark::DoNotOptimize(total);
+    }
+}
+
+std::vector<BigUInt> makeSummands(const benchmark::State& state) {
+    auto count = static_cast<size_t>(state.range(0));
+    auto range = static_cast<size_t>(state.range(1));
+    std::vector<BigUInt> numbers;
+    numbers.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        numbers.push_back(createTestBigUInt(std::vector<Chunk>(range, MAX_VALUE - i)));
+    }
+    return numbers;
+}
+
+void benchSum(benchmark::State& state) {
+    std::vector<BigUInt> numbers = makeSummands(state);
+
+    for (auto iter : state) {
+        benchmark::DoNotOptimize(sum(numbers));
+    }
+}
+
+void benchSumByAdd(benchmark::State& state) {
+    std::vector<BigUInt> numbers = makeSummands(state);
+
+    for (auto iter : state) {
+        BigUInt total;
+        for (const BigUInt& number : numbers) {
+            total = add(total, number);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+}
 }  // namespace
 constexpr size_t MAX_SIZE = 5556;
 BENCHMARK(benchAdd)->Range(1, MAX_SIZE);  // NOLINT(cert-err58-cpp)
 BENCHMARK(benchSub)->Range(1, MAX_SIZE);  // NOLINT(cert-err58-cpp)
+BENCHMARK(benchAddLong)->RangeMultiplier(4)->Range(16, 1 << 20);  // NOLINT(cert-err58-cpp)
+BENCHMARK(benchAddInPlace)->Range(1, MAX_SIZE);  // NOLINT(cert-err58-cpp)
+BENCHMARK(benchSubInPlace)->Range(1, MAX_SIZE);  // NOLINT(cert-err58-cpp)
+BENCHMARK(benchSum)->ArgsProduct({{16, 256, 4096}, {4, 64, 1024}});       // NOLINT(cert-err58-cpp)
+BENCHMARK(benchSumByAdd)->ArgsProduct({{16, 256, 4096}, {4, 64, 1024}});  // NOLINT(cert-err58-cpp)
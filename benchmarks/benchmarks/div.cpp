@@ -0,0 +1,32 @@
+#include <benchmark/benchmark.h>
+#include <big_uint.hpp>
+
+#include "tools.hpp"
+
+using namespace big_uint;
+namespace {
+// A 2n-limb dividend by an n-limb divisor, the shape of a modular reduction.
+void benchDiv(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    BigUInt dividend = createPatternBigUInt(2 * range, 7919);
+    BigUInt divisor = createPatternBigUInt(range, 104729);
+
+    for (auto iter : state) {
+        benchmark::DoNotOptimize(divMod(dividend, divisor));
+    }
+}
+
+// A long dividend by a two-limb divisor, where the quotient is long and the divisor is not.
+void benchDivByShort(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    BigUInt dividend = createPatternBigUInt(range, 7919);
+    BigUInt divisor = createPatternBigUInt(2, 104729);
+
+    for (auto iter : state) {
+        benchmark::DoNotOptimize(divMod(dividend, divisor));
+    }
+}
+}  // namespace
+constexpr size_t MAX_SIZE = 5556;
+BENCHMARK(benchDiv)->Range(2, MAX_SIZE);         // NOLINT(cert-err58-cpp)
+BENCHMARK(benchDivByShort)->Range(2, MAX_SIZE);  // NOLINT(cert-err58-cpp)
@@ -0,0 +1,41 @@
+#include <benchmark/benchmark.h>
+#include <big_uint.hpp>
+
+#include "tools.hpp"
+
+using namespace big_uint;
+namespace {
+// Limbs scrambled by a multiplicative hash. Arithmetic progressions of limbs, as elsewhere, give
+// pairs whose Euclid sequence ends after a few dozen large quotients.
+BigUInt makeScrambledBigUInt(size_t size, Chunk seed) {
+    constexpr Chunk MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+    std::vector<Chunk> limbs(size);
+    for (size_t i = 0; i < size; ++i) {
+        limbs[i] = ((i + 1) * seed * MULTIPLIER) % MAX_VALUE;
+    }
+    return createTestBigUInt(limbs);
+}
+
+void benchGcd(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    BigUInt lhs = makeScrambledBigUInt(range, 7919);
+    BigUInt rhs = makeScrambledBigUInt(range, 104729);
+
+    for (auto iter : state) {
+        benchmark::DoNotOptimize(gcd(lhs, rhs));
+    }
+}
+
+void benchModInverse(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    BigUInt number = makeScrambledBigUInt(range, 7919);
+    BigUInt modulus = addSmall(makeScrambledBigUInt(range, 104729), 2);
+
+    for (auto iter : state) {
+        benchmark::DoNotOptimize(modInverse(number, modulus));
+    }
+}
+}  // namespace
+constexpr size_t MAX_SIZE = 5556;
+BENCHMARK(benchGcd)->Range(1, MAX_SIZE);         // NOLINT(cert-err58-cpp)
+BENCHMARK(benchModInverse)->Range(1, MAX_SIZE);  // NOLINT(cert-err58-cpp)
@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+#include <big_uint.hpp>
+
+#include "tools.hpp"
+
+using namespace big_uint;
+namespace {
+// An odd modulus ending in 3, so both reductions apply.
+BigUInt makeModulus(size_t size) {
+    std::vector<Chunk> limbs(size);
+    for (size_t i = 0; i < size; ++i) {
+        limbs[i] = MAX_VALUE - ((i * 104729) % MAX_VALUE);
+    }
+    limbs[0] = 1000000000000000003ULL;
+    return createTestBigUInt(limbs);
+}
+
+BigUInt makeResidue(const BigUInt& modulus, Chunk step) {
+    std::vector<Chunk> limbs(getSize(modulus));
+    for (size_t i = 0; i < limbs.size(); ++i) {
+        limbs[i] = MAX_VALUE - ((i * step) % MAX_VALUE);
+    }
+    return divMod(createTestBigUInt(limbs), modulus).remainder;
+}
+
+void benchMulMod(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    ModContext context = makeModContext(makeModulus(range));
+    BigUInt lhs = makeResidue(context.modulus, 7919);
+    BigUInt rhs = makeResidue(context.modulus, 31);
+
+    for (auto iter : state) {
+        benchmark::DoNotOptimize(mulMod(context, lhs, rhs));
+    }
+}
+
+void benchMontgomeryMul(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    ModContext context = makeModContext(makeModulus(range));
+    BigUInt lhs = toMontgomery(context, makeResidue(context.modulus, 7919));
+    BigUInt rhs = toMontgomery(context, makeResidue(context.modulus, 31));
+
+    for (auto iter : state) {
+        benchmark::DoNotOptimize(montgomeryMul(context, lhs, rhs));
+    }
+}
+
+// The same product reduced by a division every time, for comparison.
+void benchMulThenDivMod(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    BigUInt modulus = makeModulus(range);
+    BigUInt lhs = makeResidue(modulus, 7919);
+    BigUInt rhs = makeResidue(modulus, 31);
+
+    for (auto iter : state) {
+        benchmark::DoNotOptimize(divMod(mul(lhs, rhs), modulus));
+    }
+}
+}  // namespace
+constexpr size_t MAX_SIZE = 5556;
+BENCHMARK(benchMulMod)->Range(1, MAX_SIZE);         // NOLINT(cert-err58-cpp)
+BENCHMARK(benchMontgomeryMul)->Range(1, MAX_SIZE);  // NOLINT(cert-err58-cpp)
+BENCHMARK(benchMulThenDivMod)->Range(1, MAX_SIZE);  // NOLINT(cert-err58-cpp)
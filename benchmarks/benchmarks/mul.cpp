@@ -18,6 +18,98 @@ void benchMul(benchmark::State& state) {
         mul(lhs, rhs);
     }
 }
+
+void benchMulUnbalanced(benchmark::State& state) {
+    auto lhsSize = static_cast<size_t>(state.range(0));
+    auto rhsSize = static_cast<size_t>(state.range(1));
+
+    BigUInt lhs = createTestBigUInt(std::vector<Chunk>(lhsSize, INT64_MAX));
+    BigUInt rhs = createTestBigUInt(std::vector<Chunk>(rhsSize, INT64_MAX));
+
+    for (auto iter : state) {
+        mul(lhs, rhs);
+    }
+}
+
+void benchMulPrepared(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    std::vector<Chunk> limbs(range, INT64_MAX);
+
+    BigUInt lhs = createTestBigUInt(limbs);
+    PreparedMul rhs = prepare(createTestBigUInt(limbs));
+
+    for (auto iter : state) {
+        mul(lhs, rhs);
+    }
+}
+
+void benchMulParallel(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    auto threadCount = static_cast<size_t>(state.range(1));
+    std::vector<Chunk> limbs(range, INT64_MAX);
+
+    BigUInt lhs = createTestBigUInt(limbs);
+    BigUInt rhs = createTestBigUInt(limbs);
+
+    MulParallelism previous = getMulParallelism();
+    setMulParallelism({.threadCount = threadCount, .minLimbs = 0});
+    for (auto iter : state) {
+        mul(lhs, rhs);
+    }
+    setMulParallelism(previous);
+}
+
+void benchSqr(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    std::vector<Chunk> limbs(range, INT64_MAX);
+
+    BigUInt number = createTestBigUInt(limbs);
+
+    for (auto iter : state) {
+        sqr(number);
+    }
+}
+
+void benchAddMul(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    std::vector<Chunk> limbs(range, INT64_MAX);
+
+    BigUInt lhs = createTestBigUInt(limbs);
+    BigUInt rhs = createTestBigUInt(limbs);
+    BigUInt accumulator = createTestBigUInt(std::vector<Chunk>(2 * range, INT64_MAX));
+
+    for (auto iter : state) {
+        addMul(accumulator, lhs, rhs);
+    }
+    benchmark::DoNotOptimize(accumulator);
+}
+
+void benchMulThenAdd(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    std::vector<Chunk> limbs(range, INT64_MAX);
+
+    BigUInt lhs = createTestBigUInt(limbs);
+    BigUInt rhs = createTestBigUInt(limbs);
+    BigUInt accumulator = createTestBigUInt(std::vector<Chunk>(2 * range, INT64_MAX));
+
+    for (auto iter : state) {
+        accumulator = add(accumulator, mul(lhs, rhs));
+    }
+    benchmark::DoNotOptimize(accumulator);
+}
 }  // namespace
 constexpr size_t MAX_SIZE = 5556;
 BENCHMARK(benchMul)->Range(1, MAX_SIZE);  // NOLINT(cert-err58-cpp)
+// Operand sizes around the Karatsuba, Toom-3 and Toom-4 crossovers.
+BENCHMARK(benchMul)->DenseRange(32, 64, 8);     // NOLINT(cert-err58-cpp)
+BENCHMARK(benchMul)->DenseRange(250, 600, 50);  // NOLINT(cert-err58-cpp)
+BENCHMARK(benchMulPrepared)->Range(1, MAX_SIZE);  // NOLINT(cert-err58-cpp)
+BENCHMARK(benchSqr)->Range(1, MAX_SIZE);          // NOLINT(cert-err58-cpp)
+// Long operand against short operands from the schoolbook range up to the NTT range.
+BENCHMARK(benchMulUnbalanced)  // NOLINT(cert-err58-cpp)
+    ->ArgsProduct({{4096, 32768}, {16, 64, 256, 1024}});
+BENCHMARK(benchMulParallel)  // NOLINT(cert-err58-cpp)
+    ->ArgsProduct({{16384, 131072}, {1, 2, 4, 8, 16, 32}})
+    ->UseRealTime();
+BENCHMARK(benchAddMul)->RangeMultiplier(2)->Range(1, 64);      // NOLINT(cert-err58-cpp)
+BENCHMARK(benchMulThenAdd)->RangeMultiplier(2)->Range(1, 64);  // NOLINT(cert-err58-cpp)
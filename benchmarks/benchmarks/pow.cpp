@@ -0,0 +1,78 @@
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+#include <big_uint.hpp>
+
+#include "tools.hpp"
+
+using namespace big_uint;
+namespace {
+// 3^k with about range limbs in the result.
+void benchPow(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    BigUInt three = createTestBigUInt({3});
+    uint64_t exponent = range * 39;
+
+    for (auto iter : state) {
+        benchmark::DoNotOptimize(pow(three, exponent));
+    }
+}
+
+// The same power by repeated multiplication, for comparison.
+void benchPowByMul(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    BigUInt three = createTestBigUInt({3});
+    uint64_t exponent = range * 39;
+
+    for (auto iter : state) {
+        BigUInt result = createTestBigUInt({1});
+        for (uint64_t step = 0; step < exponent; ++step) {
+            result = mul(result, three);
+        }
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+void benchPowOfTen(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    BigUInt ten = createTestBigUInt({10});
+    uint64_t exponent = range * MAX_VALUE_LENGTH;
+
+    for (auto iter : state) {
+        benchmark::DoNotOptimize(pow(ten, exponent));
+    }
+}
+
+// An exponent as long as the modulus, as in RSA-style verification. The modulus ends in 3, so the
+// Montgomery path is taken.
+void benchPowMod(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    BigUInt modulus = subSmall(createPatternBigUInt(range, 104729), 6);
+    BigUInt base = createPatternBigUInt(range, 7919);
+    BigUInt exponent = createPatternBigUInt(range, 31);
+
+    for (auto iter : state) {
+        benchmark::DoNotOptimize(powMod(base, exponent, modulus));
+    }
+}
+
+// The same with an even modulus, which only has Barrett reduction.
+void benchPowModEven(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    BigUInt modulus = subSmall(createPatternBigUInt(range, 104729), 1);
+    BigUInt base = createPatternBigUInt(range, 7919);
+    BigUInt exponent = createPatternBigUInt(range, 31);
+
+    for (auto iter : state) {
+        benchmark::DoNotOptimize(powMod(base, exponent, modulus));
+    }
+}
+}  // namespace
+constexpr size_t MAX_SIZE = 5556;
+constexpr size_t MAX_POW_BY_MUL_SIZE = 512;
+constexpr size_t MAX_POW_MOD_SIZE = 128;
+BENCHMARK(benchPow)->Range(1, MAX_SIZE);                   // NOLINT(cert-err58-cpp)
+BENCHMARK(benchPowByMul)->Range(1, MAX_POW_BY_MUL_SIZE);   // NOLINT(cert-err58-cpp)
+BENCHMARK(benchPowOfTen)->Range(1, MAX_SIZE);              // NOLINT(cert-err58-cpp)
+BENCHMARK(benchPowMod)->Range(1, MAX_POW_MOD_SIZE);        // NOLINT(cert-err58-cpp)
+BENCHMARK(benchPowModEven)->Range(1, MAX_POW_MOD_SIZE);    // NOLINT(cert-err58-cpp)
@@ -0,0 +1,28 @@
+#include <benchmark/benchmark.h>
+#include <big_uint.hpp>
+
+#include "tools.hpp"
+
+using namespace big_uint;
+namespace {
+void benchIsqrt(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    BigUInt number = createPatternBigUInt(range, 7919);
+
+    for (auto iter : state) {
+        benchmark::DoNotOptimize(isqrt(number));
+    }
+}
+
+void benchCubeRoot(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    BigUInt number = createPatternBigUInt(range, 7919);
+
+    for (auto iter : state) {
+        benchmark::DoNotOptimize(iroot(number, 3));
+    }
+}
+}  // namespace
+constexpr size_t MAX_SIZE = 5556;
+BENCHMARK(benchIsqrt)->Range(1, MAX_SIZE);     // NOLINT(cert-err58-cpp)
+BENCHMARK(benchCubeRoot)->Range(1, MAX_SIZE);  // NOLINT(cert-err58-cpp)
@@ -0,0 +1,54 @@
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+#include <big_uint.hpp>
+
+#include "tools.hpp"
+
+using namespace big_uint;
+namespace {
+constexpr uint64_t WORD = 1000000007;
+
+void benchMulSmall(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    BigUInt number = createTestBigUInt(std::vector<Chunk>(range, INT64_MAX));
+
+    for (auto iter : state) {
+        benchmark::DoNotOptimize(mulSmall(number, WORD));
+    }
+}
+
+// The same product through the general dispatcher, for comparison.
+void benchMulByLimb(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    BigUInt number = createTestBigUInt(std::vector<Chunk>(range, INT64_MAX));
+    BigUInt word = createTestBigUInt({WORD});
+
+    for (auto iter : state) {
+        benchmark::DoNotOptimize(mul(number, word));
+    }
+}
+
+void benchAddSmall(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    BigUInt number = createTestBigUInt(std::vector<Chunk>(range, INT64_MAX));
+
+    for (auto iter : state) {
+        benchmark::DoNotOptimize(addSmall(number, WORD));
+    }
+}
+
+void benchDivModSmall(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    BigUInt number = createTestBigUInt(std::vector<Chunk>(range, INT64_MAX));
+
+    for (auto iter : state) {
+        benchmark::DoNotOptimize(divModSmall(number, WORD));
+    }
+}
+}  // namespace
+constexpr size_t MAX_SIZE = 5556;
+BENCHMARK(benchMulSmall)->Range(1, MAX_SIZE);     // NOLINT(cert-err58-cpp)
+BENCHMARK(benchMulByLimb)->Range(1, MAX_SIZE);    // NOLINT(cert-err58-cpp)
+BENCHMARK(benchAddSmall)->Range(1, MAX_SIZE);     // NOLINT(cert-err58-cpp)
+BENCHMARK(benchDivModSmall)->Range(1, MAX_SIZE);  // NOLINT(cert-err58-cpp)
@@ -1,4 +1,5 @@
 #include <cstdint>
+#include <string>
 
 #include <benchmark/benchmark.h>
 #include <big_uint.hpp>
@@ -17,6 +18,20 @@ void benchToString(benchmark::State& state) {
         toString(number);
     }
 }
+
+// Into a buffer allocated once, as when serialising into a preallocated message.
+void benchToChars(benchmark::State& state) {
+    auto range = static_cast<size_t>(state.range(0));
+    std::vector<Chunk> limbs(range, INT64_MAX);
+
+    BigUInt number = createTestBigUInt(limbs);
+    std::string buffer(decimalLength(number), '\0');
+
+    for (auto iter : state) {
+        benchmark::DoNotOptimize(toChars(number, buffer.data(), buffer.data() + buffer.size()));
+    }
+}
 }  // namespace
 constexpr size_t MAX_SIZE = 5556;
 BENCHMARK(benchToString)->Range(1, MAX_SIZE);  // NOLINT(cert-err58-cpp)
+BENCHMARK(benchToChars)->Range(1, MAX_SIZE);   // NOLINT(cert-err58-cpp)
@@ -3,3 +3,6 @@
 using namespace big_uint;
 
 BigUInt createTestBigUInt(std::vector<Chunk> limbs = {});
+
+// size limbs counting down from MAX_VALUE by step, so that every limb differs and most are large.
+BigUInt createPatternBigUInt(size_t size, Chunk step);
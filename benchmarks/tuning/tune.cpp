@@ -0,0 +1,189 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <big_uint.hpp>
+
+using namespace big_uint;
+
+namespace {
+constexpr size_t NEVER = std::numeric_limits<size_t>::max();
+constexpr double MIN_SECONDS = 0.02;
+constexpr int ROUNDS = 3;
+// A candidate only counts as a crossover if the faster algorithm keeps winning for this many
+// consecutive sizes, which filters out timer noise and power-of-two steps of the NTT.
+constexpr int CONFIRMATIONS = 2;
+
+BigUInt makeOperand(size_t size, uint64_t seed) {
+    std::vector<Chunk> limbs(size);
+    uint64_t state = seed;
+    for (Chunk& limb : limbs) {
+        state = (state * 6364136223846793005ULL) + 1442695040888963407ULL;
+        limb = state % (MAX_VALUE + 1);
+    }
+    limbs.back() = std::max<Chunk>(limbs.back(), 1);
+    return BigUInt{limbs};
+}
+
+double measure(const Thresholds& thresholds, const std::function<void()>& operation) {
+    setThresholds(thresholds);
+    double best = std::numeric_limits<double>::max();
+    for (int round = 0; round < ROUNDS; ++round) {
+        size_t iterations = 0;
+        auto start = std::chrono::steady_clock::now();
+        double elapsed = 0;
+        do {
+            operation();
+            ++iterations;
+            std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+            elapsed = duration.count();
+        } while (elapsed < MIN_SECONDS);
+        best = std::min(best, elapsed / static_cast<double>(iterations));
+    }
+    return best;
+}
+
+// Returns the first candidate from which `faster` beats `slower`, or `fallback` if it never does.
+size_t findCrossover(const char* name, const std::vector<size_t>& candidates, size_t fallback,
+                     const std::function<bool(size_t)>& fasterWins) {
+    int streak = 0;
+    for (size_t index = 0; index < candidates.size(); ++index) {
+        streak = fasterWins(candidates[index]) ? streak + 1 : 0;
+        if (streak == CONFIRMATIONS) {
+            size_t crossover = candidates[index + 1 - CONFIRMATIONS];
+            std::cerr << name << ": " << crossover << '\n';
+            return crossover;
+        }
+    }
+    std::cerr << name << ": no crossover, keeping " << fallback << '\n';
+    return fallback;
+}
+
+std::vector<size_t> range(size_t first, size_t last, size_t step) {
+    std::vector<size_t> sizes;
+    for (size_t size = first; size <= last; size += step) {
+        sizes.push_back(size);
+    }
+    return sizes;
+}
+
+// Every threshold is found by comparing one level of the faster algorithm on top of the slower
+// one, with the thresholds measured so far for everything below.
+Thresholds tune() {
+    Thresholds tuned = getDefaultThresholds();
+    Thresholds base{.karatsuba = NEVER,
+                    .sqrKaratsuba = NEVER,
+                    .toom3 = NEVER,
+                    .toom4 = NEVER,
+                    .ntt = NEVER,
+                    .unbalancedNtt = NEVER,
+                    .newtonDivision = NEVER,
+                    .halfGcd = NEVER,
+                    .nttPiece = tuned.nttPiece};
+
+    tuned.karatsuba =
+        findCrossover("karatsuba", range(8, 256, 8), tuned.karatsuba, [&](size_t size) {
+            BigUInt lhs = makeOperand(size, 1);
+            BigUInt rhs = makeOperand(size, 2);
+            auto operation = [&] { mul(lhs, rhs); };
+            Thresholds faster = base;
+            faster.karatsuba = size;
+            Thresholds slower = base;
+            slower.karatsuba = size + 1;
+            return measure(faster, operation) < measure(slower, operation);
+        });
+    base.karatsuba = tuned.karatsuba;
+
+    tuned.sqrKaratsuba =
+        findCrossover("sqr_karatsuba", range(8, 384, 8), tuned.sqrKaratsuba, [&](size_t size) {
+            BigUInt number = makeOperand(size, 3);
+            auto operation = [&] { sqr(number); };
+            Thresholds faster = base;
+            faster.sqrKaratsuba = size;
+            Thresholds slower = base;
+            slower.sqrKaratsuba = size + 1;
+            return measure(faster, operation) < measure(slower, operation);
+        });
+    base.sqrKaratsuba = tuned.sqrKaratsuba;
+
+    tuned.toom3 = findCrossover("toom3", range(64, 1200, 32), tuned.toom3, [&](size_t size) {
+        BigUInt lhs = makeOperand(size, 4);
+        BigUInt rhs = makeOperand(size, 5);
+        auto operation = [&] { mul(lhs, rhs); };
+        Thresholds faster = base;
+        faster.toom3 = size;
+        return measure(faster, operation) < measure(base, operation);
+    });
+    base.toom3 = tuned.toom3;
+
+    tuned.toom4 = findCrossover("toom4", range(96, 2000, 32), tuned.toom4, [&](size_t size) {
+        BigUInt lhs = makeOperand(size, 6);
+        BigUInt rhs = makeOperand(size, 7);
+        auto operation = [&] { mul(lhs, rhs); };
+        Thresholds faster = base;
+        faster.toom4 = size;
+        return measure(faster, operation) < measure(base, operation);
+    });
+    base.toom4 = tuned.toom4;
+
+    tuned.ntt = findCrossover("ntt", range(128, 8192, 64), tuned.ntt, [&](size_t size) {
+        BigUInt lhs = makeOperand(size, 8);
+        BigUInt rhs = makeOperand(size, 9);
+        auto operation = [&] { mul(lhs, rhs); };
+        Thresholds faster = base;
+        faster.ntt = size;
+        return measure(faster, operation) < measure(base, operation);
+    });
+    base.ntt = tuned.ntt;
+
+    tuned.unbalancedNtt = findCrossover(
+        "unbalanced_ntt", range(32, std::min<size_t>(tuned.ntt, 4096), 32), tuned.unbalancedNtt,
+        [&](size_t size) {
+            BigUInt lhs = makeOperand(8 * size, 10);
+            BigUInt rhs = makeOperand(size, 11);
+            auto operation = [&] { mul(lhs, rhs); };
+            Thresholds faster = base;
+            faster.unbalancedNtt = size;
+            return measure(faster, operation) < measure(base, operation);
+        });
+    base.unbalancedNtt = tuned.unbalancedNtt;
+
+    tuned.newtonDivision = findCrossover(
+        "newton_division", range(16, 512, 16), tuned.newtonDivision, [&](size_t size) {
+            BigUInt dividend = makeOperand(2 * size, 12);
+            BigUInt divisor = makeOperand(size, 13);
+            auto operation = [&] { divMod(dividend, divisor); };
+            Thresholds faster = base;
+            faster.newtonDivision = size;
+            return measure(faster, operation) < measure(base, operation);
+        });
+    base.newtonDivision = tuned.newtonDivision;
+
+    tuned.halfGcd = findCrossover("half_gcd", range(32, 1024, 32), tuned.halfGcd, [&](size_t size) {
+        BigUInt lhs = makeOperand(size, 14);
+        BigUInt rhs = makeOperand(size, 15);
+        auto operation = [&] { gcd(lhs, rhs); };
+        Thresholds faster = base;
+        faster.halfGcd = size;
+        return measure(faster, operation) < measure(base, operation);
+    });
+    return tuned;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    const string path = argc > 1 ? argv[1] : "big_uint_thresholds.conf";
+    Thresholds tuned = tune();
+    if (!saveThresholds(path, tuned)) {
+        std::cerr << "cannot write " << path << '\n';
+        return 1;
+    }
+    std::cerr << "written to " << path << ", load it with loadThresholds() or through the "
+              << "BIG_UINT_THRESHOLDS environment variable\n";
+    return 0;
+}
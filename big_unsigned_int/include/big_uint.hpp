@@ -1,6 +1,8 @@
 #pragma once
 
+#include <charconv>
 #include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -18,6 +20,69 @@ struct BigUInt {
     std::vector<Chunk> limbs;
 };
 
+// An operand that is multiplied many times. For NTT-sized operands it keeps the forward transforms
+// of the operand, so every product only transforms the other factor and the result.
+struct PreparedMul {
+    BigUInt operand;
+    size_t transformSize;
+    std::vector<std::vector<uint32_t>> spectra;
+};
+
+// Multiplication stays on the calling thread unless threadCount is above one. Products whose
+// shorter factor has fewer than minLimbs limbs always run single-threaded.
+struct MulParallelism {
+    size_t threadCount;
+    size_t minLimbs;
+};
+
+// Operand sizes, in limbs, from which multiplication and division use each algorithm. Karatsuba
+// and Toom-Cook look at the shorter factor of each recursive product; the NTT at the shorter factor
+// of the whole product, with unbalancedNtt applying when the other factor is at least twice as
+// long. Division uses a Newton reciprocal once both the divisor and the quotient reach
+// newtonDivision limbs, and gcd reduces numbers of halfGcd limbs and more by half-GCD recursion.
+// A shorter NTT factor above nttPiece limbs is cut into pieces of that size; the default and upper
+// limit is the longest factor a single transform can take.
+struct Thresholds {
+    size_t karatsuba;
+    size_t sqrKaratsuba;
+    size_t toom3;
+    size_t toom4;
+    size_t ntt;
+    size_t unbalancedNtt;
+    size_t newtonDivision;
+    size_t halfGcd;
+    size_t nttPiece;
+};
+
+struct SmallDivMod {
+    BigUInt quotient;
+    uint64_t remainder;
+};
+
+struct DivMod {
+    BigUInt quotient;
+    BigUInt remainder;
+};
+
+// gcd = lhs * lhsFactor - rhs * rhsFactor, or rhs * rhsFactor - lhs * lhsFactor when lhsNegative
+// is set. The factors are Euclid's cofactors, bounded by rhs / gcd and lhs / gcd.
+struct ExtendedGcd {
+    BigUInt gcd;
+    BigUInt lhsFactor;
+    BigUInt rhsFactor;
+    bool lhsNegative;
+};
+
+// A modulus prepared for repeated reduction. For an n-limb modulus, reciprocal is
+// floor(BASE^(2n) / modulus) for Barrett reduction. A modulus coprime to 10 also gets Montgomery
+// reduction with R = BASE^n, for which montgomeryInverse is -modulus^-1 mod R.
+struct ModContext {
+    BigUInt modulus;
+    BigUInt reciprocal;
+    bool hasMontgomery;
+    BigUInt montgomeryInverse;
+};
+
 BigUInt makeBigUInt(const std::vector<Digit>& digits) noexcept;
 
 BigUInt makeZero() noexcept;
@@ -30,12 +95,135 @@ BigUInt sub(const BigUInt& minuend, const BigUInt& subtrahend) noexcept;
 
 BigUInt sub(const BigUInt& minuend, const BigUInt& subtrahend, size_t shift) noexcept;
 
+// Accumulate into the left operand, reusing its storage; it grows only when the carry leaves the
+// top limb. As with sub(), subtracting a larger number leaves zero.
+void addInPlace(BigUInt& augend, const BigUInt& addend) noexcept;
+
+void subInPlace(BigUInt& minuend, const BigUInt& subtrahend) noexcept;
+
+BigUInt& operator+=(BigUInt& augend, const BigUInt& addend) noexcept;
+
+BigUInt& operator-=(BigUInt& minuend, const BigUInt& subtrahend) noexcept;
+
+// Adds all numbers at once. Limb columns are accumulated without carrying and normalised a single
+// time at the end, so the cost is one pass over the input plus one over the result.
+BigUInt sum(std::span<const BigUInt> numbers) noexcept;
+
+// Arithmetic with a single machine word, without building a BigUInt for it. The word may be above
+// MAX_VALUE. subSmall gives zero for a larger subtrahend, as sub() does, and dividing by zero gives
+// a zero quotient and remainder.
+BigUInt mulSmall(const BigUInt& number, uint64_t factor) noexcept;
+
+BigUInt addSmall(const BigUInt& number, uint64_t addend) noexcept;
+
+BigUInt subSmall(const BigUInt& number, uint64_t subtrahend) noexcept;
+
+SmallDivMod divModSmall(const BigUInt& number, uint64_t divisor) noexcept;
+
+// Quotient and remainder of a long division. As with divModSmall, dividing by zero gives a zero
+// quotient and remainder.
+DivMod divMod(const BigUInt& dividend, const BigUInt& divisor) noexcept;
+
+// Divides once, when the context is built; reductions then cost two multiplications each. With a
+// zero modulus every result is zero.
+ModContext makeModContext(const BigUInt& modulus) noexcept;
+
+BigUInt reduce(const ModContext& context, const BigUInt& number) noexcept;
+
+// The operands of addMod and subMod must be below the modulus; mulMod and sqrMod take any size.
+BigUInt addMod(const ModContext& context, const BigUInt& augend, const BigUInt& addend) noexcept;
+
+BigUInt subMod(const ModContext& context, const BigUInt& minuend,
+               const BigUInt& subtrahend) noexcept;
+
+BigUInt mulMod(const ModContext& context, const BigUInt& multiplicand,
+               const BigUInt& multiplier) noexcept;
+
+BigUInt sqrMod(const ModContext& context, const BigUInt& number) noexcept;
+
+// Montgomery form number * R mod modulus, only for a context with hasMontgomery. Products stay in
+// the form, so a chain of multiplications converts once on the way in and once on the way out.
+// Operands of montgomeryMul and montgomerySqr must be below the modulus.
+BigUInt toMontgomery(const ModContext& context, const BigUInt& number) noexcept;
+
+BigUInt fromMontgomery(const ModContext& context, const BigUInt& number) noexcept;
+
+BigUInt montgomeryMul(const ModContext& context, const BigUInt& multiplicand,
+                      const BigUInt& multiplier) noexcept;
+
+BigUInt montgomerySqr(const ModContext& context, const BigUInt& number) noexcept;
+
+// base^exponent by left-to-right binary exponentiation. Powers of ten, and more generally bases
+// ending in zero limbs, cost a limb shift instead of the matching multiplications.
+BigUInt pow(const BigUInt& base, uint64_t exponent) noexcept;
+
+// floor(number^(1/2)) and floor(number^(1/degree)). The root of the top half of the number is
+// found first and refined with Newton steps, so the cost is a few full-size multiplications and
+// divisions. A degree of zero gives zero.
+BigUInt isqrt(const BigUInt& number) noexcept;
+
+BigUInt iroot(const BigUInt& number, uint64_t degree) noexcept;
+
+// base^exponent mod modulus by sliding-window exponentiation, in Montgomery form when the modulus
+// allows it. The context overload reuses a prepared modulus.
+BigUInt powMod(const BigUInt& base, const BigUInt& exponent, const BigUInt& modulus) noexcept;
+
+BigUInt powMod(const ModContext& context, const BigUInt& base, const BigUInt& exponent) noexcept;
+
+// Greatest common divisor by Lehmer steps, which take out the quotients decided by the top two
+// limbs with single-limb arithmetic, and for large numbers by half-GCD recursion, which finds the
+// quotients of the top half of the numbers first so that the cost is a few multiplications per
+// level. gcd(0, 0) is zero.
+BigUInt gcd(const BigUInt& lhs, const BigUInt& rhs) noexcept;
+
+ExtendedGcd extendedGcd(const BigUInt& lhs, const BigUInt& rhs) noexcept;
+
+// The inverse of number modulo modulus in [0, modulus), or zero when there is none.
+BigUInt modInverse(const BigUInt& number, const BigUInt& modulus) noexcept;
+
 BigUInt mul(const BigUInt& multiplicand, const BigUInt& multiplier) noexcept;
 
+BigUInt sqr(const BigUInt& number) noexcept;
+
+// accumulator += multiplicand * multiplier. Products small enough for schoolbook multiplication
+// are added straight into the accumulator's limbs, without a temporary product.
+void addMul(BigUInt& accumulator, const BigUInt& multiplicand, const BigUInt& multiplier) noexcept;
+
+// multiplicand * multiplier + addend.
+BigUInt fma(const BigUInt& multiplicand, const BigUInt& multiplier, const BigUInt& addend) noexcept;
+
+PreparedMul prepare(const BigUInt& operand) noexcept;
+
+BigUInt mul(const BigUInt& multiplicand, const PreparedMul& multiplier) noexcept;
+
+void setMulParallelism(MulParallelism parallelism) noexcept;
+
+MulParallelism getMulParallelism() noexcept;
+
+Thresholds getThresholds() noexcept;
+
+Thresholds getDefaultThresholds() noexcept;
+
+void setThresholds(const Thresholds& thresholds) noexcept;
+
+// Reads "name = value" lines as written by saveThresholds and run_tuning. Names that are missing
+// keep their current values; on a malformed file nothing changes and false is returned.
+bool loadThresholds(const string& path) noexcept;
+
+bool saveThresholds(const string& path, const Thresholds& thresholds) noexcept;
+
 size_t getSize(const BigUInt& number) noexcept;
 
 string toString(const BigUInt& number) noexcept;
 
+// Digits in the decimal form of number, one for zero. Only the top limb is looked at, so buffers
+// can be sized exactly without formatting.
+size_t decimalLength(const BigUInt& number) noexcept;
+
+// Writes number in decimal to [first, last) without allocating, as std::to_chars does: ptr is one
+// past the last digit, or last with value_too_large when the digits do not fit.
+std::to_chars_result toChars(const BigUInt& number, char* first, char* last) noexcept;
+
 bool isZero(const BigUInt& number) noexcept;
 
 bool isEqual(const BigUInt& left, const BigUInt& right) noexcept;
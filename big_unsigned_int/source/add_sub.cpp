@@ -1,96 +1,171 @@
 #include <algorithm>
+#include <compare>
 #include <cstddef>
+#include <span>
+#include <utility>
 
 #include "big_uint.hpp"
 #include "getters.hpp"
+#include "limbs.hpp"
 
 namespace big_uint {
 namespace {
 
-std::vector<Chunk> removeLeadingZeros(const std::vector<Chunk>& limbs) {
-    if (limbs.empty()) {
-        return {};
-    }
-    auto lastNonZero = static_cast<int64_t>(-1);
-    for (int64_t i = static_cast<int64_t>(limbs.size()) - 1; i >= 0; --i) {
-        if (limbs[static_cast<size_t>(i)] != 0) {
-            lastNonZero = i;
-            break;
-        }
+BigUInt shiftLimbs(const BigUInt& number, size_t shift) {
+    const std::vector<Chunk>& limbs = getLimbs(number);
+    std::vector<Chunk> shiftedLimbs(shift, 0);
+    shiftedLimbs.insert(shiftedLimbs.end(), limbs.begin(), limbs.end());
+    normalize(shiftedLimbs);
+    return BigUInt{std::move(shiftedLimbs)};
+}
+
+// Writes source plus carry into target, which has the same size, and returns the carry out. Once
+// the carry is absorbed the rest is a plain copy.
+Carry copyWithCarry(std::span<const Chunk> source, std::span<Chunk> target, Carry carry) {
+    size_t index = 0;
+    for (; carry != 0 && index < source.size(); ++index) {
+        target[index] = addWithCarry(source[index], 0, carry);
     }
-    if (lastNonZero == -1) {
-        return {};
+    std::copy(source.begin() + static_cast<std::ptrdiff_t>(index), source.end(),
+              target.begin() + static_cast<std::ptrdiff_t>(index));
+    return carry;
+}
+
+Carry copyWithBorrow(std::span<const Chunk> source, std::span<Chunk> target, Carry borrow) {
+    size_t index = 0;
+    for (; borrow != 0 && index < source.size(); ++index) {
+        target[index] = subWithBorrow(source[index], 0, borrow);
     }
-    return {limbs.begin(), limbs.begin() + lastNonZero + 1};
+    std::copy(source.begin() + static_cast<std::ptrdiff_t>(index), source.end(),
+              target.begin() + static_cast<std::ptrdiff_t>(index));
+    return borrow;
 }
 
+// Computes augend * BASE^shift + addend. The limbs split into a prefix below the shift that only
+// the addend covers, an overlap where both operands have limbs, and a tail of the longer operand
+// that the carry ripples into, so no loop checks operand bounds per limb.
 BigUInt addInternal(const BigUInt& augend, const BigUInt& addend, size_t shift = 0) {
-    const std::vector<Chunk>& leftLimbs = getLimbs(augend);
-    const std::vector<Chunk>& rightLimbs = getLimbs(addend);
-    size_t leftSize = leftLimbs.size();
-    size_t rightSize = rightLimbs.size();
-    size_t maxSize = std::max(leftSize + shift, rightSize);
+    std::span<const Chunk> left = getLimbs(augend);
+    std::span<const Chunk> right = getLimbs(addend);
+    size_t maxSize = std::max(left.size() + shift, right.size());
     if (maxSize == 0) {
         return makeZero();
     }
-    std::vector<Chunk> result;
-    result.reserve(maxSize + 1);
-    Chunk carry = 0;
-    for (size_t i = 0; i < maxSize; ++i) {
-        Chunk leftChunk = 0;
-        Chunk rightChunk = (i < rightSize) ? rightLimbs[i] : 0;
-        if (i >= shift && (i - shift) < leftSize) {
-            leftChunk = leftLimbs[i - shift];
-        }
-        __uint128_t sum = static_cast<__uint128_t>(leftChunk) +
-                          static_cast<__uint128_t>(rightChunk) + static_cast<__uint128_t>(carry);
-        if (sum > MAX_VALUE) {
-            result.push_back(static_cast<Chunk>(sum - MAX_VALUE - 1));
-            carry = 1;
-        } else {
-            result.push_back(static_cast<Chunk>(sum));
-            carry = 0;
-        }
+    std::vector<Chunk> result(maxSize + 1);
+    std::span<Chunk> target(result);
+
+    size_t prefix = std::min(shift, right.size());
+    std::copy_n(right.begin(), prefix, target.begin());
+
+    size_t overlapEnd = std::max(shift, std::min(left.size() + shift, right.size()));
+    size_t overlap = overlapEnd - shift;
+    Carry carry = 0;
+    if (overlap > 0) {
+        carry = static_cast<Carry>(addLimbs(target.subspan(shift, overlap), left.first(overlap),
+                                            right.subspan(shift, overlap)));
     }
-    if (carry != 0) {
-        result.push_back(carry);
+
+    if (left.size() + shift > overlapEnd) {
+        carry = copyWithCarry(left.subspan(overlapEnd - shift),
+                              target.subspan(overlapEnd, maxSize - overlapEnd), carry);
+    } else if (right.size() > overlapEnd) {
+        carry = copyWithCarry(right.subspan(overlapEnd),
+                              target.subspan(overlapEnd, maxSize - overlapEnd), carry);
     }
-    return BigUInt{removeLeadingZeros(result)};
+    result[maxSize] = static_cast<Chunk>(carry);
+    normalize(result);
+    return BigUInt{std::move(result)};
 }
 
+// Computes minuend * BASE^shift - subtrahend for a minuend that is not the lower of the two, in
+// the same prefix, overlap and tail phases as addInternal.
 BigUInt subInternal(const BigUInt& minuend, const BigUInt& subtrahend, size_t shift = 0) {
-    const std::vector<Chunk>& leftLimbs = getLimbs(minuend);
-    const std::vector<Chunk>& rightLimbs = getLimbs(subtrahend);
-    size_t leftSize = leftLimbs.size();
-    size_t rightSize = rightLimbs.size();
-    if (leftSize == 0 && rightSize == 0) {
+    std::span<const Chunk> left = getLimbs(minuend);
+    std::span<const Chunk> right = getLimbs(subtrahend);
+    size_t maxSize = std::max(left.size() + shift, right.size());
+    if (maxSize == 0) {
         return makeZero();
     }
-    size_t maxSize = std::max(leftSize + shift, rightSize);
-    std::vector<Chunk> result;
-    result.reserve(maxSize);
-    Chunk borrow = 0;
-    for (size_t i = 0; i < maxSize; ++i) {
-        Chunk leftChunk = 0;
-        Chunk rightChunk = (i < rightSize) ? rightLimbs[i] : 0;
-        if (i >= shift && (i - shift) < leftSize) {
-            leftChunk = leftLimbs[i - shift];
-        }
-        if (borrow > leftChunk) {
-            result.push_back(static_cast<Chunk>(MAX_VALUE + 1 + leftChunk - rightChunk - borrow));
-            borrow = 1;
-        } else {
-            leftChunk -= borrow;
-            if (leftChunk < rightChunk) {
-                result.push_back(static_cast<Chunk>(MAX_VALUE + 1 + leftChunk - rightChunk));
-                borrow = 1;
-            } else {
-                result.push_back(leftChunk - rightChunk);
-                borrow = 0;
-            }
+    std::vector<Chunk> result(maxSize);
+    std::span<Chunk> target(result);
+
+    size_t prefix = std::min(shift, right.size());
+    Carry borrow = 0;
+    for (size_t index = 0; index < prefix; ++index) {
+        target[index] = subWithBorrow(0, right[index], borrow);
+    }
+    // Zero minus a pending borrow is MAX_VALUE with the borrow kept, in every limb of the gap.
+    Chunk gapLimb = MAX_VALUE & (0 - static_cast<Chunk>(borrow));
+    std::fill(target.begin() + static_cast<std::ptrdiff_t>(prefix),
+              target.begin() + static_cast<std::ptrdiff_t>(shift), gapLimb);
+
+    size_t overlapEnd = std::max(shift, std::min(left.size() + shift, right.size()));
+    for (size_t index = shift; index < overlapEnd; ++index) {
+        target[index] = subWithBorrow(left[index - shift], right[index], borrow);
+    }
+
+    copyWithBorrow(left.subspan(overlapEnd - shift), target.subspan(overlapEnd), borrow);
+    normalize(result);
+    return BigUInt{std::move(result)};
+}
+
+// Orders minuend * BASE^shift against subtrahend without building the shifted number. Both are
+// taken to be trimmed, as every public operation leaves them.
+std::strong_ordering compareShifted(const BigUInt& minuend, const BigUInt& subtrahend,
+                                    size_t shift) {
+    std::span<const Chunk> left = getLimbs(minuend);
+    std::span<const Chunk> right = getLimbs(subtrahend);
+    left = left.first(significantSize(left));
+    right = right.first(significantSize(right));
+    if (left.empty() || right.empty()) {
+        return left.size() <=> right.size();
+    }
+    if (left.size() + shift != right.size()) {
+        return left.size() + shift <=> right.size();
+    }
+    std::strong_ordering ordering = compareLimbs(left, right.subspan(shift));
+    if (ordering != std::strong_ordering::equal) {
+        return ordering;
+    }
+    return significantSize(right.first(shift)) == 0 ? std::strong_ordering::equal
+                                                    : std::strong_ordering::less;
+}
+
+// Columns summed per pass of sum(); two accumulator words per column keep a block inside L1.
+constexpr size_t SUM_BLOCK_LIMBS = 1024;
+
+// Adds limbs into column accumulators of the form high * 2^64 + low. high counts the wraps of low
+// and grows by at most one per operand, so nothing overflows before 2^64 operands.
+void accumulateColumns(std::span<Chunk> low, std::span<Chunk> high, std::span<const Chunk> limbs) {
+    for (size_t index = 0; index < limbs.size(); ++index) {
+        Chunk column = low[index] + limbs[index];
+        high[index] += static_cast<Chunk>(column < limbs[index]);
+        low[index] = column;
+    }
+}
+
+// Adds four operands per pass over their common length, so each accumulator is loaded and stored
+// once per group rather than once per operand.
+void accumulateColumns(std::span<Chunk> low, std::span<Chunk> high,
+                       std::span<const std::span<const Chunk>, 4> group) {
+    size_t common = group[0].size();
+    for (std::span<const Chunk> limbs : group) {
+        common = std::min(common, limbs.size());
+    }
+    for (size_t index = 0; index < common; ++index) {
+        Chunk column = low[index];
+        Chunk wraps = high[index];
+        for (std::span<const Chunk> limbs : group) {
+            Chunk next = column + limbs[index];
+            wraps += static_cast<Chunk>(next < column);
+            column = next;
         }
+        low[index] = column;
+        high[index] = wraps;
+    }
+    for (std::span<const Chunk> limbs : group) {
+        accumulateColumns(low.subspan(common), high.subspan(common), limbs.subspan(common));
     }
-    return BigUInt{removeLeadingZeros(result)};
 }
 
 }  // namespace
@@ -109,13 +184,7 @@ BigUInt sub(const BigUInt& minuend, const BigUInt& subtrahend) noexcept {
     if (isZero(subtrahend)) {
         return minuend;
     }
-    if (isZero(minuend)) {
-        return makeZero();
-    }
-    if (isEqual(minuend, subtrahend)) {
-        return makeZero();
-    }
-    if (isLower(minuend, subtrahend)) {
+    if (compareShifted(minuend, subtrahend, 0) != std::strong_ordering::greater) {
         return makeZero();
     }
     return subInternal(minuend, subtrahend);
@@ -132,10 +201,7 @@ BigUInt add(const BigUInt& augend, const BigUInt& addend, size_t shift) noexcept
         if (shift == 0) {
             return augend;
         }
-        const std::vector<Chunk>& augendLimbs = getLimbs(augend);
-        std::vector<Chunk> shiftedLimbs(shift, 0);
-        shiftedLimbs.insert(shiftedLimbs.end(), augendLimbs.begin(), augendLimbs.end());
-        return BigUInt{removeLeadingZeros(shiftedLimbs)};
+        return shiftLimbs(augend, shift);
     }
     return addInternal(augend, addend, shift);
 }
@@ -145,30 +211,102 @@ BigUInt sub(const BigUInt& minuend, const BigUInt& subtrahend, size_t shift) noe
         if (shift == 0) {
             return minuend;
         }
-        const std::vector<Chunk>& minuendLimbs = getLimbs(minuend);
-        std::vector<Chunk> shiftedLimbs(shift, 0);
-        shiftedLimbs.insert(shiftedLimbs.end(), minuendLimbs.begin(), minuendLimbs.end());
-        return BigUInt{removeLeadingZeros(shiftedLimbs)};
+        return shiftLimbs(minuend, shift);
     }
-    if (isZero(minuend)) {
+    if (compareShifted(minuend, subtrahend, shift) != std::strong_ordering::greater) {
         return makeZero();
     }
-    BigUInt shiftedMinuend;
-    if (shift == 0) {
-        shiftedMinuend = minuend;
-    } else {
-        const std::vector<Chunk>& minuendLimbs = getLimbs(minuend);
-        std::vector<Chunk> shiftedLimbs(shift, 0);
-        shiftedLimbs.insert(shiftedLimbs.end(), minuendLimbs.begin(), minuendLimbs.end());
-        shiftedMinuend = BigUInt{removeLeadingZeros(shiftedLimbs)};
+    return subInternal(minuend, subtrahend, shift);
+}
+
+void addInPlace(BigUInt& augend, const BigUInt& addend) noexcept {
+    std::span<const Chunk> addendLimbs = addend.limbs;
+    addendLimbs = addendLimbs.first(significantSize(addendLimbs));
+    if (augend.limbs.size() < addendLimbs.size()) {
+        augend.limbs.resize(addendLimbs.size());
     }
-    if (isEqual(shiftedMinuend, subtrahend)) {
-        return makeZero();
+    // Only a carry out of the top limb needs a reallocation, and the sum of two trimmed numbers
+    // is trimmed already, so the common case touches neither the capacity nor the size.
+    if (addLimbs(augend.limbs, addendLimbs) != 0) {
+        augend.limbs.push_back(1);
+    }
+    normalize(augend.limbs);
+}
+
+void subInPlace(BigUInt& minuend, const BigUInt& subtrahend) noexcept {
+    std::span<const Chunk> subtrahendLimbs = subtrahend.limbs;
+    subtrahendLimbs = subtrahendLimbs.first(significantSize(subtrahendLimbs));
+    normalize(minuend.limbs);
+    // Like sub(), a subtrahend larger than the minuend leaves zero; the borrow out of the top limb
+    // detects it without a separate comparison pass.
+    if (minuend.limbs.size() < subtrahendLimbs.size() ||
+        subLimbs(minuend.limbs, subtrahendLimbs) != 0) {
+        minuend.limbs.clear();
+        return;
+    }
+    normalize(minuend.limbs);
+}
+
+BigUInt& operator+=(BigUInt& augend, const BigUInt& addend) noexcept {
+    addInPlace(augend, addend);
+    return augend;
+}
+
+BigUInt& operator-=(BigUInt& minuend, const BigUInt& subtrahend) noexcept {
+    subInPlace(minuend, subtrahend);
+    return minuend;
+}
+
+BigUInt sum(std::span<const BigUInt> numbers) noexcept {
+    size_t maxSize = 0;
+    for (const BigUInt& number : numbers) {
+        maxSize = std::max(maxSize, significantSize(getLimbs(number)));
     }
-    if (isLower(shiftedMinuend, subtrahend)) {
+    if (maxSize == 0) {
         return makeZero();
     }
-    return subInternal(minuend, subtrahend, shift);
+    std::vector<Chunk> result(maxSize);
+    std::vector<Chunk> low(std::min(SUM_BLOCK_LIMBS, maxSize));
+    std::vector<Chunk> high(low.size());
+    std::vector<std::span<const Chunk>> pieces;
+    pieces.reserve(numbers.size());
+    Chunk carry = 0;
+    for (size_t begin = 0; begin < maxSize; begin += SUM_BLOCK_LIMBS) {
+        size_t width = std::min(SUM_BLOCK_LIMBS, maxSize - begin);
+        std::fill_n(low.begin(), width, 0);
+        std::fill_n(high.begin(), width, 0);
+        pieces.clear();
+        for (const BigUInt& number : numbers) {
+            std::span<const Chunk> limbs = getLimbs(number);
+            if (limbs.size() > begin) {
+                pieces.push_back(limbs.subspan(begin, std::min(width, limbs.size() - begin)));
+            }
+        }
+        size_t piece = 0;
+        for (; piece + 4 <= pieces.size(); piece += 4) {
+            accumulateColumns(low, high, std::span(pieces).subspan(piece).first<4>());
+        }
+        for (; piece < pieces.size(); ++piece) {
+            accumulateColumns(low, high, pieces[piece]);
+        }
+        // Carries are normalised once per column, after every operand has been added to it. The
+        // high word of a column is at most the operand count, so every column splits independently
+        // into a limb and a quotient below BASE, and the quotients are then added one limb up.
+        std::span<Chunk> block = std::span<Chunk>(result).subspan(begin, width);
+        low[0] += carry;
+        high[0] += static_cast<Chunk>(low[0] < carry);
+        for (size_t index = 0; index < width; ++index) {
+            high[index] = divModBase((static_cast<WideChunk>(high[index]) << 64U) | low[index],
+                                     block[index]);
+        }
+        carry = high[width - 1] + addLimbs(block.subspan(1), std::span(high).first(width - 1));
+    }
+    while (carry != 0) {
+        result.push_back(carry % BASE);
+        carry /= BASE;
+    }
+    normalize(result);
+    return BigUInt{std::move(result)};
 }
 
 }  // namespace big_uint
@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "big_uint.hpp"
+#include "getters.hpp"
+#include "limbs.hpp"
+
+namespace big_uint {
+namespace {
+// Knuth's algorithm D for a divisor of at least two limbs. Both operands are scaled by
+// BASE / (top + 1), which brings the divisor's top limb to at least BASE / 2, so an estimate from
+// the top two limbs of the running remainder is at most two above the quotient limb; the check
+// against the second divisor limb nearly always settles it before the multiply-subtract.
+DivMod divKnuth(std::span<const Chunk> dividend, std::span<const Chunk> divisor) {
+    size_t size = divisor.size();
+    size_t length = dividend.size();
+    Chunk scale = BASE / (divisor.back() + 1);
+    std::vector<Chunk> scaledDivisor(size);
+    mulSmallLimbs(scaledDivisor, divisor, scale);
+    std::vector<Chunk> rest(length + 1);
+    rest[length] = mulSmallLimbs(std::span<Chunk>(rest).first(length), dividend, scale);
+
+    Chunk top = scaledDivisor[size - 1];
+    Chunk next = scaledDivisor[size - 2];
+    auto shift = static_cast<unsigned>(std::countl_zero(top));
+    Chunk normalized = top << shift;
+    Chunk reciprocal = reciprocalOf(normalized);
+
+    std::vector<Chunk> quotient(length - size + 1);
+    for (size_t position = quotient.size(); position-- > 0;) {
+        std::span<Chunk> window = std::span<Chunk>(rest).subspan(position, size + 1);
+        WideChunk numerator = (static_cast<WideChunk>(window[size]) * BASE) + window[size - 1];
+        Chunk estimate = MAX_VALUE;
+        WideChunk estimateRest = 0;
+        if (window[size] < top) {
+            Chunk remainder = 0;
+            estimate = divModWide(numerator << shift, normalized, reciprocal, remainder);
+            estimateRest = remainder >> shift;
+        } else {
+            estimateRest = numerator - (static_cast<WideChunk>(estimate) * top);
+        }
+        while (estimateRest < BASE && static_cast<WideChunk>(estimate) * next >
+                                          (estimateRest * BASE) + window[size - 2]) {
+            --estimate;
+            estimateRest += top;
+        }
+        Chunk borrow = subMulLimbs(window.first(size), scaledDivisor, estimate);
+        if (window[size] < borrow) {
+            --estimate;
+            borrow -= addLimbs(window.first(size), scaledDivisor);
+        }
+        window[size] -= borrow;
+        quotient[position] = estimate;
+    }
+
+    rest.resize(size);
+    divSmallLimbs(rest, scale);
+    normalize(rest);
+    normalize(quotient);
+    return {.quotient = BigUInt{std::move(quotient)}, .remainder = BigUInt{std::move(rest)}};
+}
+
+// floor(BASE^(2n) / divisor) for an n-limb divisor, possibly a few units low or high. The
+// reciprocal y of the top k = n / 2 + 2 limbs gives half the limbs, and one Newton step doubles
+// them: with x = y * BASE^(n - k), x + x * (BASE^(2n) - divisor * x) / BASE^(2n) reduces to
+// y * BASE^(n - k) + y * (BASE^(n + k) - divisor * y) / BASE^(2k). The error is about n / 2 limbs
+// long, so its low k - 2 limbs are dropped before the multiplication; they change the correction
+// by less than one.
+BigUInt approximateReciprocal(std::span<const Chunk> divisor, size_t newtonLimbs) {
+    size_t size = divisor.size();
+    if (size < newtonLimbs) {
+        return divKnuth(getLimbs(powerOfBase(2 * size)), divisor).quotient;
+    }
+    size_t topSize = (size / 2) + 2;
+    BigUInt topReciprocal = approximateReciprocal(divisor.last(topSize), newtonLimbs);
+    BigUInt estimate = shiftUp(topReciprocal, size - topSize);
+    BigUInt product = mul(fromLimbs(divisor), topReciprocal);
+    BigUInt power = powerOfBase(size + topSize);
+    if (isLowerOrEqual(product, power)) {
+        BigUInt error = shiftDown(sub(power, product), topSize - 2);
+        return add(estimate, shiftDown(mul(topReciprocal, error), topSize + 2));
+    }
+    BigUInt error = shiftDown(sub(product, power), topSize - 2);
+    return subSmall(sub(estimate, shiftDown(mul(topReciprocal, error), topSize + 2)), 1);
+}
+
+// Corrects a quotient that is within a few units of floor(number / divisor).
+DivMod settle(BigUInt quotient, const BigUInt& number, const BigUInt& divisor) {
+    BigUInt product = mul(quotient, divisor);
+    while (isGreater(product, number)) {
+        quotient = subSmall(quotient, 1);
+        product = sub(product, divisor);
+    }
+    BigUInt remainder = sub(number, product);
+    while (isGreaterOrEqual(remainder, divisor)) {
+        quotient = addSmall(quotient, 1);
+        remainder = sub(remainder, divisor);
+    }
+    return {.quotient = std::move(quotient), .remainder = std::move(remainder)};
+}
+
+// Divides a number below divisor * BASE^n by the n-limb divisor. Only the limbs of the number from
+// n - 1 up take part in the estimate, which keeps it within a few units of the quotient.
+DivMod divideBlock(const BigUInt& number, const BigUInt& divisor, const BigUInt& reciprocal,
+                   size_t size) {
+    return settle(shiftDown(mul(shiftDown(number, size - 1), reciprocal), size + 1), number,
+                  divisor);
+}
+
+// Schoolbook division in base BASE^n. The top n - 1 limbs are below the divisor and start the
+// remainder; the rest of the dividend is taken n limbs at a time from the top, and every block is
+// divided with multiplications by the same reciprocal.
+DivMod divNewton(std::span<const Chunk> dividend, std::span<const Chunk> divisor,
+                 size_t newtonLimbs) {
+    size_t size = divisor.size();
+    BigUInt divisorNumber = fromLimbs(divisor);
+    BigUInt reciprocal = approximateReciprocal(divisor, newtonLimbs);
+    std::vector<Chunk> quotient(dividend.size());
+    size_t end = dividend.size() - (size - 1);
+    BigUInt remainder = fromLimbs(dividend.subspan(end));
+    while (end > 0) {
+        size_t begin = end - std::min(end, size);
+        BigUInt number =
+            add(remainder, fromLimbs(dividend.subspan(begin, end - begin)), end - begin);
+        DivMod block = divideBlock(number, divisorNumber, reciprocal, size);
+        std::span<const Chunk> blockLimbs = significantLimbs(block.quotient);
+        std::copy(blockLimbs.begin(), blockLimbs.end(),
+                  quotient.begin() + static_cast<std::ptrdiff_t>(begin));
+        remainder = std::move(block.remainder);
+        end = begin;
+    }
+    normalize(quotient);
+    return {.quotient = BigUInt{std::move(quotient)}, .remainder = std::move(remainder)};
+}
+}  // namespace
+
+DivMod divMod(const BigUInt& dividend, const BigUInt& divisor) noexcept {
+    std::span<const Chunk> numerator = significantLimbs(dividend);
+    std::span<const Chunk> denominator = significantLimbs(divisor);
+    if (denominator.empty()) {
+        return {.quotient = makeZero(), .remainder = makeZero()};
+    }
+    if (compareLimbs(numerator, denominator) < 0) {
+        return {.quotient = makeZero(), .remainder = fromLimbs(numerator)};
+    }
+    if (denominator.size() == 1) {
+        SmallDivMod result = divModSmall(dividend, denominator[0]);
+        std::vector<Chunk> remainder;
+        if (result.remainder != 0) {
+            remainder.push_back(result.remainder);
+        }
+        return {.quotient = std::move(result.quotient), .remainder = BigUInt{std::move(remainder)}};
+    }
+    // Knuth's division costs the divisor length times the quotient length; the reciprocal pays
+    // off once both are long enough for subquadratic multiplication.
+    size_t newtonLimbs = getThresholds().newtonDivision;
+    size_t quotientSize = numerator.size() - denominator.size() + 1;
+    if (denominator.size() < newtonLimbs || quotientSize < newtonLimbs) {
+        return divKnuth(numerator, denominator);
+    }
+    // The quotient only depends on the top quotientSize + 2 limbs of the divisor, up to one unit,
+    // so a longer divisor is cut down before its reciprocal is taken.
+    size_t dropped = denominator.size() - std::min(denominator.size(), quotientSize + 2);
+    if (dropped == 0) {
+        return divNewton(numerator, denominator, newtonLimbs);
+    }
+    DivMod estimate =
+        divNewton(numerator.subspan(dropped), denominator.subspan(dropped), newtonLimbs);
+    return settle(std::move(estimate.quotient), fromLimbs(numerator), fromLimbs(denominator));
+}
+}  // namespace big_uint
@@ -0,0 +1,344 @@
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "big_uint.hpp"
+#include "limbs.hpp"
+
+namespace big_uint {
+namespace {
+// Lehmer's cofactors stay below this, so that a column of two limbs times two cofactors stays
+// within COLUMN_BIAS * BASE of zero.
+constexpr SignedWideChunk MAX_COFACTOR = SignedWideChunk{1} << 60U;
+constexpr SignedWideChunk COLUMN_BIAS = SignedWideChunk{1} << 62U;
+// The top two limbs are shifted down by two bits, which keeps them and every sum with a cofactor
+// below 2^127.
+constexpr unsigned LEADING_SHIFT = 2;
+
+// A product of Euclid's quotient matrices [[q, 1], [1, 0]], so that (a, b) = matrix * (a', b')
+// takes the reduced pair back to the original one. Every entry is nonnegative and the determinant
+// is -1 for an odd number of quotients.
+struct Matrix {
+    BigUInt m00;
+    BigUInt m01;
+    BigUInt m10;
+    BigUInt m11;
+    bool odd;
+};
+
+Matrix identityMatrix() {
+    return {.m00 = BigUInt{{1}},
+            .m01 = makeZero(),
+            .m10 = makeZero(),
+            .m11 = BigUInt{{1}},
+            .odd = false};
+}
+
+bool isIdentity(const Matrix& matrix) {
+    return isZero(matrix.m01) && isZero(matrix.m10);
+}
+
+Matrix mulMatrices(const Matrix& lhs, const Matrix& rhs) {
+    return {.m00 = add(mul(lhs.m00, rhs.m00), mul(lhs.m01, rhs.m10)),
+            .m01 = add(mul(lhs.m00, rhs.m01), mul(lhs.m01, rhs.m11)),
+            .m10 = add(mul(lhs.m10, rhs.m00), mul(lhs.m11, rhs.m10)),
+            .m11 = add(mul(lhs.m10, rhs.m01), mul(lhs.m11, rhs.m11)),
+            .odd = lhs.odd != rhs.odd};
+}
+
+// The quotients found by a Lehmer step, as a matrix of single limbs with the same layout.
+struct LehmerMatrix {
+    Chunk m00;
+    Chunk m01;
+    Chunk m10;
+    Chunk m11;
+    bool odd;
+};
+
+void mulLehmer(Matrix& matrix, const LehmerMatrix& step) {
+    auto combine = [](const BigUInt& lhs, Chunk lhsFactor, const BigUInt& rhs, Chunk rhsFactor) {
+        return add(mulSmall(lhs, lhsFactor), mulSmall(rhs, rhsFactor));
+    };
+    matrix = {.m00 = combine(matrix.m00, step.m00, matrix.m01, step.m10),
+              .m01 = combine(matrix.m00, step.m01, matrix.m01, step.m11),
+              .m10 = combine(matrix.m10, step.m00, matrix.m11, step.m10),
+              .m11 = combine(matrix.m10, step.m01, matrix.m11, step.m11),
+              .odd = matrix.odd != step.odd};
+}
+
+void mulQuotient(Matrix& matrix, const BigUInt& quotient) {
+    matrix = {.m00 = add(mul(matrix.m00, quotient), matrix.m01),
+              .m01 = std::move(matrix.m00),
+              .m10 = add(mul(matrix.m10, quotient), matrix.m11),
+              .m11 = std::move(matrix.m10),
+              .odd = !matrix.odd};
+}
+
+// One step of Euclid's algorithm with a full division.
+void divisionStep(BigUInt& a, BigUInt& b, Matrix* matrix) {
+    DivMod division = divMod(a, b);
+    a = std::move(b);
+    b = std::move(division.remainder);
+    if (matrix != nullptr) {
+        mulQuotient(*matrix, division.quotient);
+    }
+}
+
+// The top two limbs of number at the positions of the top two limbs of an n-limb number.
+SignedWideChunk leadingPart(std::span<const Chunk> limbs, size_t size) {
+    if (size == 1) {
+        return limbs.empty() ? 0 : limbs[0];
+    }
+    auto limbAt = [&](size_t index) {
+        return index < limbs.size() ? static_cast<WideChunk>(limbs[index]) : 0;
+    };
+    return static_cast<SignedWideChunk>(((limbAt(size - 1) * BASE) + limbAt(size - 2)) >>
+                                        LEADING_SHIFT);
+}
+
+// numerator / denominator for a positive denominator. The leading parts shrink by a word over a
+// Lehmer step, and from then on a word division does instead of a far slower 128-bit one.
+SignedWideChunk divideLeading(SignedWideChunk numerator, SignedWideChunk denominator) {
+    if (numerator >= 0 && (numerator >> 64U) == 0) {
+        return static_cast<Chunk>(numerator) / static_cast<Chunk>(denominator);
+    }
+    return numerator / denominator;
+}
+
+// Knuth's Algorithm L: Euclid's algorithm on the leading parts of a and b, keeping a quotient only
+// when the bounds of the leading parts give the same one, so that it is also the quotient of the
+// full numbers. The signed cofactors (A, B; C, D) map (a, b) to the current pair and are the
+// inverse of the quotient matrix.
+LehmerMatrix lehmerQuotients(SignedWideChunk high, SignedWideChunk low) {
+    SignedWideChunk coA = 1;
+    SignedWideChunk coB = 0;
+    SignedWideChunk coC = 0;
+    SignedWideChunk coD = 1;
+    bool odd = false;
+    while (low + coC > 0 && low + coD > 0) {
+        SignedWideChunk quotient = divideLeading(high + coA, low + coC);
+        if (quotient != divideLeading(high + coB, low + coD) || quotient >= MAX_COFACTOR) {
+            break;
+        }
+        SignedWideChunk nextC = coA - (quotient * coC);
+        SignedWideChunk nextD = coB - (quotient * coD);
+        if (nextC <= -MAX_COFACTOR || nextC >= MAX_COFACTOR || nextD <= -MAX_COFACTOR ||
+            nextD >= MAX_COFACTOR) {
+            break;
+        }
+        coA = std::exchange(coC, nextC);
+        coB = std::exchange(coD, nextD);
+        high = std::exchange(low, high - (quotient * low));
+        odd = !odd;
+    }
+    auto magnitude = [](SignedWideChunk value) {
+        return static_cast<Chunk>(value < 0 ? -value : value);
+    };
+    return {.m00 = magnitude(coD),
+            .m01 = magnitude(coB),
+            .m10 = magnitude(coC),
+            .m11 = magnitude(coA),
+            .odd = odd};
+}
+
+// Replaces (a, b) with the pair after the step, whose inverse is det * [[m11, -m01], [-m10, m00]],
+// in one pass over both numbers. Each column of a new number is a signed combination of two limbs
+// plus the carry; biased by COLUMN_BIAS * BASE it is nonnegative and below BASE * 2^64, so a
+// single divModBase splits it into the limb and the carry into the next column.
+void applyLehmer(std::vector<Chunk>& a, std::vector<Chunk>& b, const LehmerMatrix& step) {
+    constexpr auto BIAS = static_cast<WideChunk>(COLUMN_BIAS) * BASE;
+    auto column = [&](Chunk lhs, Chunk lhsFactor, Chunk rhs, Chunk rhsFactor,
+                      SignedWideChunk& carry) {
+        auto value = static_cast<SignedWideChunk>(static_cast<WideChunk>(lhs) * lhsFactor) -
+                     static_cast<SignedWideChunk>(static_cast<WideChunk>(rhs) * rhsFactor);
+        Chunk limb = 0;
+        Chunk quotient =
+            divModBase(static_cast<WideChunk>((step.odd ? -value : value) + carry) + BIAS, limb);
+        carry = static_cast<SignedWideChunk>(quotient) - COLUMN_BIAS;
+        return limb;
+    };
+    b.resize(a.size());
+    SignedWideChunk aCarry = 0;
+    SignedWideChunk bCarry = 0;
+    for (size_t index = 0; index < a.size(); ++index) {
+        Chunk aLimb = a[index];
+        Chunk bLimb = b[index];
+        a[index] = column(aLimb, step.m11, bLimb, step.m01, aCarry);
+        b[index] = column(bLimb, step.m00, aLimb, step.m10, bCarry);
+    }
+    // Both new numbers are below a, so nothing is carried out of its top limb.
+    normalize(a);
+    normalize(b);
+}
+
+// Replaces (a, b) with the pair after the quotients that the top two limbs determine. Gives false
+// when not even the first quotient is known, which is when it is at least about 2^60 and a
+// division is the better step.
+bool lehmerStep(BigUInt& a, BigUInt& b, Matrix* matrix) {
+    size_t size = a.limbs.size();
+    if (b.limbs.size() + 1 < size) {
+        return false;
+    }
+    LehmerMatrix step = lehmerQuotients(leadingPart(a.limbs, size), leadingPart(b.limbs, size));
+    if (step.m01 == 0) {
+        return false;
+    }
+    applyLehmer(a.limbs, b.limbs, step);
+    if (matrix != nullptr) {
+        mulLehmer(*matrix, step);
+    }
+    return true;
+}
+
+// Euclid's algorithm on a >= b until b has at most stopSize limbs, with the quotients batched by
+// Lehmer steps wherever the top limbs decide them. Both numbers are kept without leading zero
+// limbs.
+void lehmerGcd(BigUInt& a, BigUInt& b, size_t stopSize, Matrix* matrix) {
+    while (b.limbs.size() > stopSize) {
+        if (!lehmerStep(a, b, matrix)) {
+            divisionStep(a, b, matrix);
+        }
+    }
+}
+
+// high * BASE^shift plus lhs - rhs, or minus it when negate is set; false when that is negative.
+bool addDifference(const BigUInt& high, size_t shift, const BigUInt& lhs, const BigUInt& rhs,
+                   bool negate, BigUInt& result) {
+    BigUInt shifted = shiftUp(high, shift);
+    bool lhsNotLower = isGreaterOrEqual(lhs, rhs);
+    BigUInt difference = lhsNotLower ? sub(lhs, rhs) : sub(rhs, lhs);
+    bool positive = lhsNotLower != negate;
+    if (positive) {
+        result = add(shifted, difference);
+        return true;
+    }
+    if (isLower(shifted, difference)) {
+        return false;
+    }
+    result = sub(shifted, difference);
+    return true;
+}
+
+Matrix halfGcd(BigUInt& a, BigUInt& b, size_t halfGcdLimbs);
+
+// Reduces (a, b) by the half-GCD matrix of their limbs from shift up. Since
+// (a, b) = BASE^shift * (aTop, bTop) + (aLow, bLow), the reduced pair is the reduced top pair
+// shifted back up plus the inverse matrix applied to the low limbs alone. The quotients of the top
+// limbs are those of the whole numbers unless the last ones came too close to the dropped limbs;
+// then the pair comes out negative or out of order and is left as it was.
+void reduceByTop(BigUInt& a, BigUInt& b, size_t shift, size_t halfGcdLimbs, Matrix& matrix) {
+    BigUInt aTop = shiftDown(a, shift);
+    BigUInt bTop = shiftDown(b, shift);
+    Matrix step = halfGcd(aTop, bTop, halfGcdLimbs);
+    if (isIdentity(step)) {
+        return;
+    }
+    BigUInt aLow = lowLimbs(a, shift);
+    BigUInt bLow = lowLimbs(b, shift);
+    BigUInt nextA;
+    BigUInt nextB;
+    if (!addDifference(aTop, shift, mul(step.m11, aLow), mul(step.m01, bLow), step.odd, nextA) ||
+        !addDifference(bTop, shift, mul(step.m00, bLow), mul(step.m10, aLow), step.odd, nextB) ||
+        isLower(nextA, nextB)) {
+        return;
+    }
+    a = std::move(nextA);
+    b = std::move(nextB);
+    matrix = mulMatrices(matrix, step);
+}
+
+// Reduces an n-limb a >= b until b has at most n / 2 + 1 limbs, returning the matrix of the
+// quotients. The top half of the numbers reduces them to about 3n / 4 limbs, a division takes out
+// a quotient too large for that to find, and the top of what is left takes them the rest of the
+// way; each half is a recursive call, so the cost is a few multiplications per level. Below
+// halfGcdLimbs, Lehmer steps, linear each, are cheaper than the multiplications.
+Matrix halfGcd(BigUInt& a, BigUInt& b, size_t halfGcdLimbs) {
+    size_t size = significantLimbs(a).size();
+    size_t stopSize = (size / 2) + 1;
+    Matrix matrix = identityMatrix();
+    if (significantLimbs(b).size() <= stopSize) {
+        return matrix;
+    }
+    if (size >= halfGcdLimbs) {
+        reduceByTop(a, b, size / 2, halfGcdLimbs, matrix);
+        if (significantLimbs(b).size() > stopSize) {
+            divisionStep(a, b, &matrix);
+        }
+        size_t reducedSize = significantLimbs(a).size();
+        if (significantLimbs(b).size() > stopSize) {
+            size_t shift = (2 * stopSize) - std::min(2 * stopSize, reducedSize);
+            reduceByTop(a, b, shift, halfGcdLimbs, matrix);
+        }
+    }
+    lehmerGcd(a, b, stopSize, &matrix);
+    return matrix;
+}
+
+// Runs Euclid's algorithm on a >= b down to (gcd, 0), accumulating the quotient matrix when one is
+// given.
+void reduceToGcd(BigUInt& a, BigUInt& b, Matrix* matrix) {
+    size_t halfGcdLimbs = getThresholds().halfGcd;
+    while (!isZero(b)) {
+        size_t size = significantLimbs(a).size();
+        if (size >= halfGcdLimbs && significantLimbs(b).size() > (size / 2) + 1) {
+            Matrix step = halfGcd(a, b, halfGcdLimbs);
+            if (matrix != nullptr) {
+                *matrix = mulMatrices(*matrix, step);
+            }
+        } else if (!lehmerStep(a, b, matrix)) {
+            divisionStep(a, b, matrix);
+        }
+    }
+}
+}  // namespace
+
+BigUInt gcd(const BigUInt& lhs, const BigUInt& rhs) noexcept {
+    BigUInt a = fromLimbs(significantLimbs(lhs));
+    BigUInt b = fromLimbs(significantLimbs(rhs));
+    if (a.limbs.size() <= 1 && b.limbs.size() <= 1) {
+        std::vector<Chunk> result = {std::gcd(a.limbs.empty() ? 0 : a.limbs[0],
+                                              b.limbs.empty() ? 0 : b.limbs[0])};
+        normalize(result);
+        return BigUInt{std::move(result)};
+    }
+    if (isLower(a, b)) {
+        std::swap(a, b);
+    }
+    reduceToGcd(a, b, nullptr);
+    return a;
+}
+
+ExtendedGcd extendedGcd(const BigUInt& lhs, const BigUInt& rhs) noexcept {
+    BigUInt a = fromLimbs(significantLimbs(lhs));
+    BigUInt b = fromLimbs(significantLimbs(rhs));
+    Matrix matrix = identityMatrix();
+    if (isLower(a, b)) {
+        std::swap(a, b);
+        mulQuotient(matrix, makeZero());
+    }
+    reduceToGcd(a, b, &matrix);
+    // (lhs, rhs) = matrix * (gcd, 0), so gcd = det * (m11 * lhs - m01 * rhs).
+    return {.gcd = std::move(a),
+            .lhsFactor = std::move(matrix.m11),
+            .rhsFactor = std::move(matrix.m01),
+            .lhsNegative = matrix.odd};
+}
+
+BigUInt modInverse(const BigUInt& number, const BigUInt& modulus) noexcept {
+    if (isZero(modulus)) {
+        return makeZero();
+    }
+    ExtendedGcd result = extendedGcd(number, modulus);
+    if (!isEqual(result.gcd, BigUInt{{1}})) {
+        return makeZero();
+    }
+    BigUInt inverse = divMod(result.lhsFactor, modulus).remainder;
+    if (result.lhsNegative && !isZero(inverse)) {
+        return sub(modulus, inverse);
+    }
+    return inverse;
+}
+}  // namespace big_uint
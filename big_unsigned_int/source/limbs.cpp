@@ -0,0 +1,405 @@
+#include "limbs.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include "big_uint.hpp"
+#include "getters.hpp"
+
+namespace big_uint {
+size_t significantSize(std::span<const Chunk> limbs) {
+    size_t size = limbs.size();
+    while (size > 0 && limbs[size - 1] == 0) {
+        --size;
+    }
+    return size;
+}
+
+void normalize(std::vector<Chunk>& limbs) {
+    limbs.resize(significantSize(limbs));
+}
+
+std::span<const Chunk> significantLimbs(const BigUInt& number) {
+    std::span<const Chunk> limbs = getLimbs(number);
+    return limbs.first(significantSize(limbs));
+}
+
+BigUInt fromLimbs(std::span<const Chunk> limbs) {
+    std::vector<Chunk> result(limbs.begin(), limbs.end());
+    normalize(result);
+    return BigUInt{std::move(result)};
+}
+
+BigUInt shiftUp(const BigUInt& number, size_t shift) {
+    std::span<const Chunk> limbs = significantLimbs(number);
+    if (limbs.empty()) {
+        return makeZero();
+    }
+    std::vector<Chunk> result(shift + limbs.size());
+    std::copy(limbs.begin(), limbs.end(), result.begin() + static_cast<std::ptrdiff_t>(shift));
+    return BigUInt{std::move(result)};
+}
+
+BigUInt shiftDown(const BigUInt& number, size_t shift) {
+    std::span<const Chunk> limbs = significantLimbs(number);
+    if (limbs.size() <= shift) {
+        return makeZero();
+    }
+    return fromLimbs(limbs.subspan(shift));
+}
+
+BigUInt lowLimbs(const BigUInt& number, size_t count) {
+    std::span<const Chunk> limbs = significantLimbs(number);
+    return fromLimbs(limbs.first(std::min(count, limbs.size())));
+}
+
+BigUInt powerOfBase(size_t exponent) {
+    std::vector<Chunk> limbs(exponent + 1);
+    limbs.back() = 1;
+    return BigUInt{std::move(limbs)};
+}
+
+std::strong_ordering compareLimbs(std::span<const Chunk> lhs, std::span<const Chunk> rhs) {
+    size_t lhsSize = significantSize(lhs);
+    size_t rhsSize = significantSize(rhs);
+    if (lhsSize != rhsSize) {
+        return lhsSize <=> rhsSize;
+    }
+    for (size_t index = lhsSize; index-- > 0;) {
+        if (lhs[index] != rhs[index]) {
+            return lhs[index] <=> rhs[index];
+        }
+    }
+    return std::strong_ordering::equal;
+}
+
+namespace {
+// Operands shorter than this stay on the scalar loop; below it the vector setup costs more than the
+// shorter carry chain saves.
+constexpr size_t VECTOR_ADD_MIN_LIMBS = 32;
+
+Carry addLimbsScalar(std::span<Chunk> result, std::span<const Chunk> lhs,
+                     std::span<const Chunk> rhs) {
+    Carry carry = 0;
+    for (size_t index = 0; index < lhs.size(); ++index) {
+        result[index] = addWithCarry(lhs[index], rhs[index], carry);
+    }
+    return carry;
+}
+
+#if defined(__x86_64__)
+// Unaligned loads and stores of the vector at limbs[index]. The intrinsics take vector pointers to
+// arbitrary limbs, which only a cast and pointer arithmetic can form.
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+__attribute__((target("avx2"))) __m256i loadAvx2(std::span<const Chunk> limbs, size_t index) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(limbs.data() + index));
+}
+
+__attribute__((target("avx2"))) void storeAvx2(std::span<Chunk> limbs, size_t index,
+                                               __m256i value) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(limbs.data() + index), value);
+}
+
+__attribute__((target("avx512f"))) __m512i loadAvx512(std::span<const Chunk> limbs, size_t index) {
+    return _mm512_loadu_si512(limbs.data() + index);
+}
+
+__attribute__((target("avx512f"))) void storeAvx512(std::span<Chunk> limbs, size_t index,
+                                                    __m512i value) {
+    _mm512_storeu_si512(limbs.data() + index, value);
+}
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+// One bit per 64-bit lane of a comparison result, set where the comparison holds.
+__attribute__((target("avx2"))) unsigned laneMask(__m256i lanes) {
+    return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(lanes)));
+}
+
+// Carry-lookahead addition. Every lane adds its limbs biased by BASE_COMPLEMENT, so a lane
+// generates a carry when the 64-bit add overflows and propagates one when the biased sum is all
+// ones. With the generate and propagate bits of a vector packed into G and P, the carries into the
+// lanes are the carries of the binary sum (G | P) + G + carry, i.e. ((G | P) + G + carry) ^ P, and
+// the bit above the lanes is the carry out of the vector. Only that one integer add is serial.
+__attribute__((target("avx2"))) Carry addLimbsAvx2(std::span<Chunk> result,
+                                                   std::span<const Chunk> lhs,
+                                                   std::span<const Chunk> rhs) {
+    const __m256i bias = _mm256_set1_epi64x(static_cast<int64_t>(BASE_COMPLEMENT));
+    const __m256i base = _mm256_set1_epi64x(static_cast<int64_t>(BASE));
+    const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+    const __m256i ones = _mm256_set1_epi64x(-1);
+    const __m256i laneBits = _mm256_setr_epi64x(1, 2, 4, 8);
+    unsigned carry = 0;
+    size_t index = 0;
+    for (; index + 4 <= lhs.size(); index += 4) {
+        __m256i left = loadAvx2(lhs, index);
+        __m256i right = loadAvx2(rhs, index);
+        __m256i sum = _mm256_add_epi64(_mm256_add_epi64(left, bias), right);
+        __m256i generates = _mm256_cmpgt_epi64(_mm256_xor_si256(right, sign),
+                                               _mm256_xor_si256(sum, sign));
+        __m256i propagates = _mm256_cmpeq_epi64(sum, ones);
+        unsigned generateBits = laneMask(generates);
+        unsigned propagateBits = laneMask(propagates);
+        unsigned lookahead = (generateBits | propagateBits) + generateBits + carry;
+        carry = lookahead >> 4U;
+        __m256i carryBits = _mm256_set1_epi64x((lookahead ^ propagateBits) & 15U);
+        __m256i carriesIn = _mm256_cmpeq_epi64(_mm256_and_si256(carryBits, laneBits), laneBits);
+        __m256i carriesOut = _mm256_or_si256(generates, _mm256_and_si256(propagates, carriesIn));
+        // sum + carry in, plus BASE in the lanes that did not wrap past 2^64.
+        sum = _mm256_sub_epi64(sum, carriesIn);
+        sum = _mm256_add_epi64(sum, _mm256_andnot_si256(carriesOut, base));
+        storeAvx2(result, index, sum);
+    }
+    auto scalarCarry = static_cast<Carry>(carry);
+    for (; index < lhs.size(); ++index) {
+        result[index] = addWithCarry(lhs[index], rhs[index], scalarCarry);
+    }
+    return scalarCarry;
+}
+
+__attribute__((target("avx512f"))) Carry addLimbsAvx512(std::span<Chunk> result,
+                                                        std::span<const Chunk> lhs,
+                                                        std::span<const Chunk> rhs) {
+    const __m512i bias = _mm512_set1_epi64(static_cast<int64_t>(BASE_COMPLEMENT));
+    const __m512i base = _mm512_set1_epi64(static_cast<int64_t>(BASE));
+    const __m512i ones = _mm512_set1_epi64(-1);
+    unsigned carry = 0;
+    size_t index = 0;
+    for (; index + 8 <= lhs.size(); index += 8) {
+        __m512i left = loadAvx512(lhs, index);
+        __m512i right = loadAvx512(rhs, index);
+        __m512i sum = _mm512_add_epi64(_mm512_add_epi64(left, bias), right);
+        __mmask8 generates = _mm512_cmplt_epu64_mask(sum, right);
+        __mmask8 propagates = _mm512_cmpeq_epi64_mask(sum, ones);
+        unsigned lookahead = static_cast<unsigned>(generates | propagates) + generates + carry;
+        carry = lookahead >> 8U;
+        auto carriesIn = static_cast<__mmask8>(lookahead ^ propagates);
+        auto carriesOut = static_cast<__mmask8>(generates | (propagates & carriesIn));
+        sum = _mm512_mask_sub_epi64(sum, carriesIn, sum, ones);
+        sum = _mm512_mask_add_epi64(sum, static_cast<__mmask8>(~carriesOut), sum, base);
+        storeAvx512(result, index, sum);
+    }
+    auto scalarCarry = static_cast<Carry>(carry);
+    for (; index < lhs.size(); ++index) {
+        result[index] = addWithCarry(lhs[index], rhs[index], scalarCarry);
+    }
+    return scalarCarry;
+}
+#endif
+
+using AddKernel = Carry (*)(std::span<Chunk>, std::span<const Chunk>, std::span<const Chunk>);
+
+AddKernel selectAddKernel() {
+#if defined(__x86_64__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return addLimbsAvx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return addLimbsAvx2;
+    }
+#endif
+    return addLimbsScalar;
+}
+
+AddKernel getAddKernel() {
+    static const AddKernel kernel = selectAddKernel();
+    return kernel;
+}
+}  // namespace
+
+Chunk addLimbs(std::span<Chunk> result, std::span<const Chunk> lhs, std::span<const Chunk> rhs) {
+    if (lhs.size() < VECTOR_ADD_MIN_LIMBS) {
+        return addLimbsScalar(result, lhs, rhs);
+    }
+    return getAddKernel()(result, lhs, rhs);
+}
+
+Chunk addLimbs(std::span<Chunk> target, std::span<const Chunk> source) {
+    std::span<Chunk> overlap = target.first(source.size());
+    auto carry = static_cast<Carry>(addLimbs(overlap, overlap, source));
+    for (size_t index = source.size(); carry != 0 && index < target.size(); ++index) {
+        target[index] = addWithCarry(target[index], 0, carry);
+    }
+    return carry;
+}
+
+Chunk subLimbs(std::span<Chunk> target, std::span<const Chunk> source) {
+    Carry borrow = 0;
+    size_t index = 0;
+    for (; index < source.size(); ++index) {
+        target[index] = subWithBorrow(target[index], source[index], borrow);
+    }
+    for (; borrow != 0 && index < target.size(); ++index) {
+        target[index] = subWithBorrow(target[index], 0, borrow);
+    }
+    return borrow;
+}
+
+Chunk mulSmallLimbs(std::span<Chunk> result, std::span<const Chunk> source, Chunk factor) {
+    if (factor >= BASE) {
+        Chunk carry = 0;
+        for (size_t index = 0; index < source.size(); ++index) {
+            carry =
+                divModBase((static_cast<WideChunk>(source[index]) * factor) + carry, result[index]);
+        }
+        return carry;
+    }
+    // Below BASE every limb product splits into a limb and a quotient below BASE on its own, so
+    // the divisions do not wait for each other and only the carry of adding the quotients one limb
+    // up is serial.
+    Chunk previous = 0;
+    Carry carry = 0;
+    for (size_t index = 0; index < source.size(); ++index) {
+        Chunk rest = 0;
+        Chunk quotient = divModBase(static_cast<WideChunk>(source[index]) * factor, rest);
+        result[index] = addWithCarry(rest, previous, carry);
+        previous = quotient;
+    }
+    return previous + carry;
+}
+
+Chunk subMulLimbs(std::span<Chunk> target, std::span<const Chunk> source, Chunk factor) {
+    // Same split as mulSmallLimbs: the product limbs and their quotients are independent, and the
+    // adds and subtractions that stay serial are selects.
+    Chunk previous = 0;
+    Carry carry = 0;
+    Carry borrow = 0;
+    for (size_t index = 0; index < source.size(); ++index) {
+        Chunk rest = 0;
+        Chunk quotient = divModBase(static_cast<WideChunk>(source[index]) * factor, rest);
+        target[index] = subWithBorrow(target[index], addWithCarry(rest, previous, carry), borrow);
+        previous = quotient;
+    }
+    return previous + carry + borrow;
+}
+
+Chunk divSmallLimbs(std::span<Chunk> limbs, Chunk divisor) {
+    auto shift = static_cast<unsigned>(std::countl_zero(divisor));
+    Chunk normalized = divisor << shift;
+    Chunk reciprocal = reciprocalOf(normalized);
+    Chunk remainder = 0;
+    for (size_t index = limbs.size(); index-- > 0;) {
+        WideChunk current = ((static_cast<WideChunk>(remainder) * BASE) + limbs[index]) << shift;
+        limbs[index] = divModWide(current, normalized, reciprocal, remainder);
+        remainder >>= shift;
+    }
+    return remainder;
+}
+
+namespace {
+// Column-wise product: the products of one column are summed in binary into a 192-bit accumulator
+// and reduced by BASE once per column instead of once per product. With Accumulate every column
+// starts from the limb already in target, so the product is added in without a temporary. Returns
+// what is carried out of the last column.
+template <bool Accumulate>
+WideChunk mulColumns(std::span<const Chunk> lhs, std::span<const Chunk> rhs,
+                     std::span<Chunk> target) {
+    Chunk low = 0;
+    Chunk middle = 0;
+    Chunk high = 0;
+    size_t columns = lhs.size() + rhs.size() - 1;
+    for (size_t column = 0; column < columns; ++column) {
+        if constexpr (Accumulate) {
+            WideChunk seeded = ((static_cast<WideChunk>(middle) << 64U) | low) + target[column];
+            low = static_cast<Chunk>(seeded);
+            middle = static_cast<Chunk>(seeded >> 64U);
+        }
+        size_t first = column >= rhs.size() ? column - rhs.size() + 1 : 0;
+        size_t last = std::min(column, lhs.size() - 1);
+        for (size_t i = first; i <= last; ++i) {
+            WideChunk product = static_cast<WideChunk>(lhs[i]) * rhs[column - i];
+            WideChunk sum = ((static_cast<WideChunk>(middle) << 64U) | low) + product;
+            high += static_cast<Chunk>(sum < product);
+            low = static_cast<Chunk>(sum);
+            middle = static_cast<Chunk>(sum >> 64U);
+        }
+        Chunk rest = 0;
+        Chunk quotientHigh = divModBase((static_cast<WideChunk>(high) << 64U) | middle, rest);
+        Chunk quotientLow = divModBase((static_cast<WideChunk>(rest) << 64U) | low, target[column]);
+        low = quotientLow;
+        middle = quotientHigh;
+        high = 0;
+    }
+    return (static_cast<WideChunk>(middle) << 64U) | low;
+}
+}  // namespace
+
+void mulSchoolbook(std::span<const Chunk> lhs, std::span<const Chunk> rhs,
+                   std::span<Chunk> result) {
+    if (lhs.empty() || rhs.empty()) {
+        std::fill(result.begin(), result.end(), 0);
+        return;
+    }
+    result[lhs.size() + rhs.size() - 1] = static_cast<Chunk>(mulColumns<false>(lhs, rhs, result));
+}
+
+Chunk addMulSchoolbook(std::span<const Chunk> lhs, std::span<const Chunk> rhs,
+                       std::span<Chunk> target) {
+    if (lhs.empty() || rhs.empty()) {
+        return 0;
+    }
+    // The carry out of the product columns can reach 2 * BASE, so it is folded into the rest of
+    // target one limb at a time until it is absorbed.
+    WideChunk carry = mulColumns<true>(lhs, rhs, target);
+    for (size_t index = lhs.size() + rhs.size() - 1; carry != 0 && index < target.size();
+         ++index) {
+        carry = divModBase(carry + target[index], target[index]);
+    }
+    return static_cast<Chunk>(carry);
+}
+
+void sqrSchoolbook(std::span<const Chunk> source, std::span<Chunk> result) {
+    if (source.empty()) {
+        std::fill(result.begin(), result.end(), 0);
+        return;
+    }
+    // Same column-wise scheme as mulSchoolbook, but every product a[i] * a[j] with i < j is
+    // accumulated once and the column is doubled before the square term and the carry are added.
+    Chunk carryLow = 0;
+    Chunk carryHigh = 0;
+    size_t columns = (2 * source.size()) - 1;
+    for (size_t column = 0; column < columns; ++column) {
+        Chunk low = 0;
+        Chunk middle = 0;
+        Chunk high = 0;
+        size_t first = column >= source.size() ? column - source.size() + 1 : 0;
+        for (size_t i = first; i < column - i; ++i) {
+            WideChunk product = static_cast<WideChunk>(source[i]) * source[column - i];
+            WideChunk sum = ((static_cast<WideChunk>(middle) << 64U) | low) + product;
+            high += static_cast<Chunk>(sum < product);
+            low = static_cast<Chunk>(sum);
+            middle = static_cast<Chunk>(sum >> 64U);
+        }
+        high = (high << 1U) | (middle >> 63U);
+        middle = (middle << 1U) | (low >> 63U);
+        low <<= 1U;
+        WideChunk extra = (static_cast<WideChunk>(carryHigh) << 64U) | carryLow;
+        if (column % 2 == 0) {
+            WideChunk square = static_cast<WideChunk>(source[column / 2]) * source[column / 2];
+            WideChunk sum = ((static_cast<WideChunk>(middle) << 64U) | low) + square;
+            high += static_cast<Chunk>(sum < square);
+            low = static_cast<Chunk>(sum);
+            middle = static_cast<Chunk>(sum >> 64U);
+        }
+        WideChunk sum = ((static_cast<WideChunk>(middle) << 64U) | low) + extra;
+        high += static_cast<Chunk>(sum < extra);
+        low = static_cast<Chunk>(sum);
+        middle = static_cast<Chunk>(sum >> 64U);
+
+        Chunk rest = 0;
+        carryHigh = divModBase((static_cast<WideChunk>(high) << 64U) | middle, rest);
+        carryLow = divModBase((static_cast<WideChunk>(rest) << 64U) | low, result[column]);
+    }
+    result[columns] = carryLow;
+}
+
+}  // namespace big_uint
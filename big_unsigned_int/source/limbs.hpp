@@ -0,0 +1,130 @@
+#pragma once
+
+#include <array>
+#include <compare>
+#include <span>
+
+#include "big_uint.hpp"
+
+namespace big_uint {
+using WideChunk = __uint128_t;
+using SignedWideChunk = __int128_t;
+
+constexpr Chunk BASE = MAX_VALUE + 1;
+// Reciprocal for the Moller-Granlund division by an invariant divisor with its top bit set.
+constexpr Chunk reciprocalOf(Chunk normalizedDivisor) {
+    return static_cast<Chunk>((~static_cast<WideChunk>(0) / normalizedDivisor) -
+                              (static_cast<WideChunk>(1) << 64U));
+}
+
+// 10^0 to 10^18, every power of ten that fits in a limb.
+constexpr std::array<Chunk, MAX_VALUE_LENGTH> POWERS_OF_TEN = [] {
+    std::array<Chunk, MAX_VALUE_LENGTH> powers{};
+    Chunk power = 1;
+    for (Chunk& entry : powers) {
+        entry = power;
+        power *= 10;
+    }
+    return powers;
+}();
+
+// BASE has its top bit set, so it needs no normalisation.
+constexpr Chunk BASE_RECIPROCAL = reciprocalOf(BASE);
+
+// Divides value by a normalised divisor using its precomputed reciprocal; value >> 64 must be lower
+// than the divisor. The correction steps use masks rather than conditionals so that they never
+// become data-dependent branches.
+inline Chunk divModWide(WideChunk value, Chunk divisor, Chunk reciprocal, Chunk& remainder) {
+    auto high = static_cast<Chunk>(value >> 64U);
+    auto low = static_cast<Chunk>(value);
+    WideChunk estimate = (static_cast<WideChunk>(reciprocal) * high) + value;
+    Chunk quotient = static_cast<Chunk>(estimate >> 64U) + 1;
+    Chunk rest = low - (quotient * divisor);
+    Chunk mask = 0 - static_cast<Chunk>(rest > static_cast<Chunk>(estimate));
+    quotient += mask;
+    rest += divisor & mask;
+    auto over = static_cast<Chunk>(rest >= divisor);
+    quotient += over;
+    rest -= divisor & (0 - over);
+    remainder = rest;
+    return quotient;
+}
+
+// Splits value < BASE * 2^64 into quotient and remainder by BASE.
+inline Chunk divModBase(WideChunk value, Chunk& remainder) {
+    return divModWide(value, BASE, BASE_RECIPROCAL, remainder);
+}
+
+using Carry = unsigned char;
+
+// 2^64 - BASE. A limb biased by it overflows 64 bits exactly when the base 10^19 sum reaches BASE.
+constexpr Chunk BASE_COMPLEMENT = 0 - BASE;
+
+// Adds two limbs and the incoming carry, leaving the outgoing carry in carry. Whether the limb pair
+// generates a carry or propagates the incoming one depends only on the operands, so the carry chain
+// is a single select; the result is corrected into [0, BASE) by a masked BASE instead of a branch.
+inline Chunk addWithCarry(Chunk lhs, Chunk rhs, Carry& carry) {
+    Chunk biased = 0;
+    bool generates = __builtin_add_overflow(lhs + BASE_COMPLEMENT, rhs, &biased);
+    Carry next = biased == ~static_cast<Chunk>(0) ? carry : static_cast<Carry>(generates);
+    Chunk result = biased + carry + (BASE & (static_cast<Chunk>(next) - 1));
+    carry = next;
+    return result;
+}
+
+inline Chunk subWithBorrow(Chunk lhs, Chunk rhs, Carry& borrow) {
+    Carry next = lhs == rhs ? borrow : static_cast<Carry>(lhs < rhs);
+    Chunk result = lhs - rhs - borrow + (BASE & (0 - static_cast<Chunk>(next)));
+    borrow = next;
+    return result;
+}
+
+size_t significantSize(std::span<const Chunk> limbs);
+
+void normalize(std::vector<Chunk>& limbs);
+
+// The limbs of number without leading zero limbs.
+std::span<const Chunk> significantLimbs(const BigUInt& number);
+
+BigUInt fromLimbs(std::span<const Chunk> limbs);
+
+// number * BASE^shift.
+BigUInt shiftUp(const BigUInt& number, size_t shift);
+
+// floor(number / BASE^shift).
+BigUInt shiftDown(const BigUInt& number, size_t shift);
+
+// number mod BASE^count.
+BigUInt lowLimbs(const BigUInt& number, size_t count);
+
+// BASE^exponent.
+BigUInt powerOfBase(size_t exponent);
+
+std::strong_ordering compareLimbs(std::span<const Chunk> lhs, std::span<const Chunk> rhs);
+
+// result = lhs + rhs over lhs.size() limbs, returning the carry out; result may alias either
+// operand. Long operands go through a vectorised carry-lookahead kernel when the CPU has one.
+Chunk addLimbs(std::span<Chunk> result, std::span<const Chunk> lhs, std::span<const Chunk> rhs);
+
+Chunk addLimbs(std::span<Chunk> target, std::span<const Chunk> source);
+
+Chunk subLimbs(std::span<Chunk> target, std::span<const Chunk> source);
+
+Chunk mulSmallLimbs(std::span<Chunk> result, std::span<const Chunk> source, Chunk factor);
+
+// target -= source * factor over source.size() limbs for a factor below BASE, returning what is
+// still to be taken from the limb above.
+Chunk subMulLimbs(std::span<Chunk> target, std::span<const Chunk> source, Chunk factor);
+
+Chunk divSmallLimbs(std::span<Chunk> limbs, Chunk divisor);
+
+void mulSchoolbook(std::span<const Chunk> lhs, std::span<const Chunk> rhs, std::span<Chunk> result);
+
+// Adds lhs * rhs into target, which must have more than lhs.size() + rhs.size() - 1 limbs, and
+// returns the carry out of its top limb.
+Chunk addMulSchoolbook(std::span<const Chunk> lhs, std::span<const Chunk> rhs,
+                       std::span<Chunk> target);
+
+// Writes source^2 into result, which must hold exactly 2 * source.size() limbs.
+void sqrSchoolbook(std::span<const Chunk> source, std::span<Chunk> result);
+}  // namespace big_uint
@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+#include "big_uint.hpp"
+#include "limbs.hpp"
+
+namespace big_uint {
+namespace {
+constexpr std::array<Chunk, 10> INVERSES_MOD_TEN = {0, 1, 0, 7, 0, 0, 0, 3, 0, 9};
+// Each Newton step doubles the correct digits: 1, 2, 4, 8, 16 and then all 19.
+constexpr int INVERSE_STEPS = 5;
+
+// limb^-1 mod BASE for a limb coprime to 10, by Newton's step x * (2 - limb * x) from the inverse
+// mod 10.
+Chunk inverseModBase(Chunk limb) {
+    Chunk inverse = INVERSES_MOD_TEN[limb % 10];
+    for (int step = 0; step < INVERSE_STEPS; ++step) {
+        Chunk product = 0;
+        divModBase(static_cast<WideChunk>(limb) * inverse, product);
+        Chunk correction = product <= 2 ? 2 - product : BASE + 2 - product;
+        divModBase(static_cast<WideChunk>(inverse) * correction, inverse);
+    }
+    return inverse;
+}
+
+// -modulus^-1 mod BASE^n, lifted from the one-limb inverse by the same Newton step with the
+// precision doubled each time.
+BigUInt montgomeryInverseOf(std::span<const Chunk> modulus) {
+    size_t size = modulus.size();
+    BigUInt inverse = BigUInt{{inverseModBase(modulus[0])}};
+    for (size_t precision = 1; precision < size;) {
+        precision = std::min(2 * precision, size);
+        BigUInt product = lowLimbs(mul(fromLimbs(modulus.first(precision)), inverse), precision);
+        BigUInt correction = lowLimbs(sub(addSmall(powerOfBase(precision), 2), product), precision);
+        inverse = lowLimbs(mul(inverse, correction), precision);
+    }
+    return sub(powerOfBase(size), inverse);
+}
+
+// Barrett reduction of a number below BASE^(2n). The quotient estimated from the limbs of the
+// number from n - 1 up and the reciprocal is at most two below the true one.
+BigUInt reduceWide(const ModContext& context, const BigUInt& number) {
+    size_t size = getSize(context.modulus);
+    BigUInt quotient = shiftDown(mul(shiftDown(number, size - 1), context.reciprocal), size + 1);
+    BigUInt remainder = sub(number, mul(quotient, context.modulus));
+    while (isGreaterOrEqual(remainder, context.modulus)) {
+        remainder = sub(remainder, context.modulus);
+    }
+    return remainder;
+}
+
+// Montgomery's REDC: number * R^-1 mod modulus for a number below modulus * R. Adding the multiple
+// of the modulus that clears the low n limbs makes the division by R a shift.
+BigUInt redc(const ModContext& context, const BigUInt& number) {
+    size_t size = getSize(context.modulus);
+    BigUInt factor = lowLimbs(mul(lowLimbs(number, size), context.montgomeryInverse), size);
+    BigUInt result = shiftDown(add(number, mul(factor, context.modulus)), size);
+    if (isGreaterOrEqual(result, context.modulus)) {
+        return sub(result, context.modulus);
+    }
+    return result;
+}
+}  // namespace
+
+ModContext makeModContext(const BigUInt& modulus) noexcept {
+    std::span<const Chunk> limbs = significantLimbs(modulus);
+    ModContext context{.modulus = fromLimbs(limbs),
+                       .reciprocal = makeZero(),
+                       .hasMontgomery = false,
+                       .montgomeryInverse = makeZero()};
+    if (limbs.empty()) {
+        return context;
+    }
+    context.reciprocal = divMod(powerOfBase(2 * limbs.size()), context.modulus).quotient;
+    Chunk lowDigit = limbs[0] % 10;
+    context.hasMontgomery = lowDigit % 2 != 0 && lowDigit != 5;
+    if (context.hasMontgomery) {
+        context.montgomeryInverse = montgomeryInverseOf(limbs);
+    }
+    return context;
+}
+
+BigUInt reduce(const ModContext& context, const BigUInt& number) noexcept {
+    size_t size = getSize(context.modulus);
+    std::span<const Chunk> limbs = significantLimbs(number);
+    if (size == 0) {
+        return makeZero();
+    }
+    if (limbs.size() <= 2 * size) {
+        return reduceWide(context, number);
+    }
+    // Longer numbers are reduced n limbs at a time from the top; every step reduces a number below
+    // modulus * BASE^n.
+    size_t end = limbs.size() - (2 * size);
+    BigUInt remainder = reduceWide(context, fromLimbs(limbs.subspan(end)));
+    while (end > 0) {
+        size_t begin = end - std::min(end, size);
+        remainder = reduceWide(
+            context, add(remainder, fromLimbs(limbs.subspan(begin, end - begin)), end - begin));
+        end = begin;
+    }
+    return remainder;
+}
+
+BigUInt addMod(const ModContext& context, const BigUInt& augend, const BigUInt& addend) noexcept {
+    if (isZero(context.modulus)) {
+        return makeZero();
+    }
+    BigUInt result = add(augend, addend);
+    if (isGreaterOrEqual(result, context.modulus)) {
+        return sub(result, context.modulus);
+    }
+    return result;
+}
+
+BigUInt subMod(const ModContext& context, const BigUInt& minuend,
+               const BigUInt& subtrahend) noexcept {
+    if (isZero(context.modulus)) {
+        return makeZero();
+    }
+    if (isGreaterOrEqual(minuend, subtrahend)) {
+        return sub(minuend, subtrahend);
+    }
+    return sub(add(minuend, context.modulus), subtrahend);
+}
+
+BigUInt mulMod(const ModContext& context, const BigUInt& multiplicand,
+               const BigUInt& multiplier) noexcept {
+    return reduce(context, mul(multiplicand, multiplier));
+}
+
+BigUInt sqrMod(const ModContext& context, const BigUInt& number) noexcept {
+    return reduce(context, sqr(number));
+}
+
+BigUInt toMontgomery(const ModContext& context, const BigUInt& number) noexcept {
+    return reduce(context, shiftUp(number, getSize(context.modulus)));
+}
+
+BigUInt fromMontgomery(const ModContext& context, const BigUInt& number) noexcept {
+    return redc(context, number);
+}
+
+BigUInt montgomeryMul(const ModContext& context, const BigUInt& multiplicand,
+                      const BigUInt& multiplier) noexcept {
+    return redc(context, mul(multiplicand, multiplier));
+}
+
+BigUInt montgomerySqr(const ModContext& context, const BigUInt& number) noexcept {
+    return redc(context, sqr(number));
+}
+}  // namespace big_uint
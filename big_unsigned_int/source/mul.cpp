@@ -1,183 +1,556 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <span>
+#include <system_error>
+#include <thread>
+#include <utility>
 
 #include "big_uint.hpp"
 #include "getters.hpp"
+#include "limbs.hpp"
+#include "ntt.hpp"
 
 namespace big_uint {
 namespace {
-using MulChunk = __uint128_t;
-constexpr size_t LARGE_BYTE_LENGTH = 10000;
-constexpr uint64_t NTT_MOD = 998244353ULL;
-constexpr uint64_t NTT_ROOT = 3ULL;
-
-std::vector<Chunk> removeTrailingZeros(const std::vector<Chunk>& limbs) {
-    auto lastNonZero = static_cast<int64_t>(-1);
-    for (int64_t index = static_cast<int64_t>(limbs.size()) - 1; index >= 0; index--) {
-        if (limbs[static_cast<size_t>(index)] != 0) {
-            lastNonZero = index;
+std::atomic<size_t> parallelThreadCount{1};
+std::atomic<size_t> parallelMinLimbs{16384};
+
+// Runs task(0), ..., task(count - 1) on up to threadCount threads, the calling one included. If
+// the system refuses to start more threads, the ones already running take over the work.
+template <typename Task>
+void parallelFor(size_t count, size_t threadCount, const Task& task) {
+    std::atomic<size_t> next{0};
+    auto worker = [&] {
+        for (size_t index = next++; index < count; index = next++) {
+            task(index);
+        }
+    };
+    std::vector<std::jthread> helpers;
+    size_t helperCount = std::min(threadCount, count);
+    for (size_t helper = 1; helper < helperCount; ++helper) {
+        try {
+            helpers.emplace_back(worker);
+        } catch (const std::system_error&) {
             break;
         }
     }
-    return {limbs.begin(), limbs.begin() + lastNonZero + 1};
+    worker();
 }
 
-BigUInt simpleMul(const BigUInt& multiplicand, const BigUInt& multiplier) {
-    const std::vector<Chunk>& lhsLimbs = getLimbs(multiplicand);
-    const std::vector<Chunk>& rhsLimbs = getLimbs(multiplier);
-    size_t lhsSize = lhsLimbs.size();
-    size_t rhsSize = rhsLimbs.size();
-    std::vector<Chunk> limbs(lhsSize + rhsSize, 0);
-    for (size_t i = 0; i < lhsSize; i++) {
-        Chunk carry = 0;
-        for (size_t j = 0; j < rhsSize; j++) {
-            MulChunk product =
-                (static_cast<MulChunk>(lhsLimbs[i]) * rhsLimbs[j]) + limbs[i + j] + carry;
-            limbs[i + j] = static_cast<Chunk>(product % (MAX_VALUE + 1));
-            carry = static_cast<Chunk>(product / (MAX_VALUE + 1));
+size_t threadsFor(size_t limbCount) {
+    return limbCount >= parallelMinLimbs.load(std::memory_order_relaxed)
+               ? std::max<size_t>(parallelThreadCount.load(std::memory_order_relaxed), 1)
+               : 1;
+}
+
+struct SignedLimbs {
+    std::vector<Chunk> magnitude;
+    bool negative = false;
+};
+
+// Evaluation points are taken projectively as (x, z) pairs so that 1/2 and infinity stay integral:
+// evaluation[p][i] = x^i * z^(Parts - 1 - i), and coefficient j of the product equals
+// sum(interpolation[j][p] * value[p]) / divisors[j].
+template <size_t Parts>
+struct ToomScheme {
+    static constexpr size_t POINTS = (2 * Parts) - 1;
+    std::array<std::array<int64_t, Parts>, POINTS> evaluation;
+    std::array<std::array<int64_t, POINTS>, POINTS> interpolation;
+    std::array<Chunk, POINTS> divisors;
+};
+
+// Points 0, 1, -1, 2 and infinity.
+constexpr ToomScheme<3> TOOM3 = {
+    .evaluation = {{{1, 0, 0}, {1, 1, 1}, {1, -1, 1}, {1, 2, 4}, {0, 0, 1}}},
+    .interpolation = {{{1, 0, 0, 0, 0},
+                       {-3, 6, -2, -1, 12},
+                       {-2, 1, 1, 0, -2},
+                       {3, -3, -1, 1, -12},
+                       {0, 0, 0, 0, 1}}},
+    .divisors = {1, 6, 2, 6, 1},
+};
+
+// Points 0, 1, -1, 2, -2, 1/2 and infinity.
+constexpr ToomScheme<4> TOOM4 = {
+    .evaluation = {{{1, 0, 0, 0},
+                    {1, 1, 1, 1},
+                    {1, -1, 1, -1},
+                    {1, 2, 4, 8},
+                    {1, -2, 4, -8},
+                    {8, 4, 2, 1},
+                    {0, 0, 0, 1}}},
+    .interpolation = {{{1, 0, 0, 0, 0, 0, 0},
+                       {-360, -120, -40, 5, 3, 8, -360},
+                       {-30, 16, 16, -1, -1, 0, 96},
+                       {45, 27, -7, -1, 0, -1, 45},
+                       {6, -4, -4, 1, 1, 0, -120},
+                       {-90, -60, 20, 5, -3, 2, -90},
+                       {0, 0, 0, 0, 0, 0, 1}}},
+    .divisors = {1, 180, 24, 18, 24, 180, 1},
+};
+
+void mulLimbs(std::span<const Chunk> lhs, std::span<const Chunk> rhs, std::span<Chunk> result);
+
+// Squares are detected by identity rather than by value, which covers mul(x, x) and every piece
+// the recursive kernels split off from it.
+bool isSameLimbs(std::span<const Chunk> lhs, std::span<const Chunk> rhs) {
+    return lhs.data() == rhs.data() && lhs.size() == rhs.size();
+}
+
+struct ToomTerm {
+    std::span<const Chunk> limbs;
+    int64_t factor;
+};
+
+// Computes sum(factor * limbs) over all terms in a single pass. Every column is accumulated in a
+// signed 128-bit word and shifted by COMBINE_OFFSET limbs of BASE, so that the floor division by
+// BASE can go through the unsigned divModBase.
+SignedLimbs combine(std::span<const ToomTerm> terms) {
+    constexpr Chunk COMBINE_OFFSET = Chunk{1} << 20U;
+    constexpr WideChunk OFFSET_VALUE = static_cast<WideChunk>(COMBINE_OFFSET) * BASE;
+    size_t length = 0;
+    for (const ToomTerm& term : terms) {
+        length = std::max(length, term.limbs.size());
+    }
+    std::vector<Chunk> limbs(length + 1);
+    SignedWideChunk carry = 0;
+    for (size_t index = 0; index < length; ++index) {
+        SignedWideChunk column = carry;
+        for (const ToomTerm& term : terms) {
+            if (index < term.limbs.size()) {
+                column += static_cast<SignedWideChunk>(term.factor) * term.limbs[index];
+            }
+        }
+        Chunk shifted = divModBase(static_cast<WideChunk>(column) + OFFSET_VALUE, limbs[index]);
+        carry = static_cast<SignedWideChunk>(shifted) - COMBINE_OFFSET;
+    }
+    if (carry >= 0) {
+        limbs[length] = static_cast<Chunk>(carry);
+        normalize(limbs);
+        return SignedLimbs{std::move(limbs), false};
+    }
+    std::vector<Chunk> magnitude(length + 1);
+    magnitude[length] = static_cast<Chunk>(-carry);
+    subLimbs(magnitude, std::span<const Chunk>(limbs).first(length));
+    normalize(magnitude);
+    return SignedLimbs{std::move(magnitude), true};
+}
+
+std::span<const Chunk> toomPiece(std::span<const Chunk> limbs, size_t part, size_t index) {
+    size_t begin = std::min(index * part, limbs.size());
+    return limbs.subspan(begin, std::min(part, limbs.size() - begin));
+}
+
+template <size_t Parts>
+bool fitsToom(std::span<const Chunk> lhs, std::span<const Chunk> rhs) {
+    size_t part = (lhs.size() + Parts - 1) / Parts;
+    return rhs.size() > (Parts - 1) * part;
+}
+
+template <size_t Parts>
+void toomCook(std::span<const Chunk> lhs, std::span<const Chunk> rhs, std::span<Chunk> result,
+              const ToomScheme<Parts>& scheme) {
+    constexpr size_t POINTS = ToomScheme<Parts>::POINTS;
+    size_t part = (lhs.size() + Parts - 1) / Parts;
+    std::array<SignedLimbs, POINTS> values;
+    std::array<ToomTerm, POINTS> terms{};
+    for (size_t point = 0; point < POINTS; ++point) {
+        for (size_t index = 0; index < Parts; ++index) {
+            terms[index] = {toomPiece(lhs, part, index), scheme.evaluation[point][index]};
         }
-        if (carry > 0) {
-            limbs[i + rhsSize] += carry;
+        SignedLimbs lhsValue = combine(std::span<const ToomTerm>(terms).first(Parts));
+        std::vector<Chunk>& product = values[point].magnitude;
+        if (isSameLimbs(lhs, rhs)) {
+            product.resize(2 * lhsValue.magnitude.size());
+            mulLimbs(lhsValue.magnitude, lhsValue.magnitude, product);
+            normalize(product);
+            continue;
         }
+        for (size_t index = 0; index < Parts; ++index) {
+            terms[index] = {toomPiece(rhs, part, index), scheme.evaluation[point][index]};
+        }
+        SignedLimbs rhsValue = combine(std::span<const ToomTerm>(terms).first(Parts));
+        product.resize(lhsValue.magnitude.size() + rhsValue.magnitude.size());
+        mulLimbs(lhsValue.magnitude, rhsValue.magnitude, product);
+        normalize(product);
+        values[point].negative = lhsValue.negative != rhsValue.negative;
+    }
+
+    std::fill(result.begin(), result.end(), 0);
+    for (size_t degree = 0; degree < POINTS; ++degree) {
+        for (size_t point = 0; point < POINTS; ++point) {
+            int64_t factor = scheme.interpolation[degree][point];
+            terms[point] = {values[point].magnitude, values[point].negative ? -factor : factor};
+        }
+        std::vector<Chunk> coefficient = combine(terms).magnitude;
+        if (scheme.divisors[degree] != 1) {
+            divSmallLimbs(coefficient, scheme.divisors[degree]);
+            normalize(coefficient);
+        }
+        addLimbs(result.subspan(degree * part), coefficient);
+    }
+}
+
+// Expects lhs.size() >= rhs.size() >= Thresholds::karatsuba.
+void karatsuba(std::span<const Chunk> lhs, std::span<const Chunk> rhs, std::span<Chunk> result) {
+    size_t half = (lhs.size() + 1) / 2;
+    if (rhs.size() <= half) {
+        mulLimbs(lhs.first(half), rhs, result.first(half + rhs.size()));
+        std::fill(result.begin() + static_cast<std::ptrdiff_t>(half + rhs.size()), result.end(), 0);
+        std::vector<Chunk> high(lhs.size() - half + rhs.size());
+        mulLimbs(lhs.subspan(half), rhs, high);
+        addLimbs(result.subspan(half), std::span<const Chunk>(high).first(significantSize(high)));
+        return;
+    }
+    std::span<Chunk> lowProduct = result.first(2 * half);
+    std::span<Chunk> highProduct = result.subspan(2 * half);
+    mulLimbs(lhs.first(half), rhs.first(half), lowProduct);
+    mulLimbs(lhs.subspan(half), rhs.subspan(half), highProduct);
+
+    std::vector<Chunk> lhsSum(half + 1);
+    std::copy_n(lhs.begin(), half, lhsSum.begin());
+    lhsSum[half] = addLimbs(std::span<Chunk>(lhsSum).first(half), lhs.subspan(half));
+    std::vector<Chunk> middle(2 * half + 2);
+    if (isSameLimbs(lhs, rhs)) {
+        mulLimbs(lhsSum, lhsSum, middle);
+    } else {
+        std::vector<Chunk> rhsSum(half + 1);
+        std::copy_n(rhs.begin(), half, rhsSum.begin());
+        rhsSum[half] = addLimbs(std::span<Chunk>(rhsSum).first(half), rhs.subspan(half));
+        mulLimbs(lhsSum, rhsSum, middle);
+    }
+    subLimbs(middle, lowProduct);
+    subLimbs(middle, highProduct);
+    addLimbs(result.subspan(half), std::span<const Chunk>(middle).first(significantSize(middle)));
+}
+
+// Expects lhs.size() >= 2 * rhs.size(). The long operand is cut into blocks of rhs.size() limbs, so
+// every block product is balanced and can use the best kernel for that size.
+void mulUnbalanced(std::span<const Chunk> lhs, std::span<const Chunk> rhs,
+                   std::span<Chunk> result) {
+    std::fill(result.begin(), result.end(), 0);
+    std::vector<Chunk> product(2 * rhs.size());
+    for (size_t begin = 0; begin < lhs.size(); begin += rhs.size()) {
+        std::span<const Chunk> block = lhs.subspan(begin, std::min(rhs.size(), lhs.size() - begin));
+        std::span<Chunk> blockProduct = std::span<Chunk>(product).first(block.size() + rhs.size());
+        mulLimbs(block, rhs, blockProduct);
+        addLimbs(result.subspan(begin),
+                 std::span<const Chunk>(blockProduct).first(significantSize(blockProduct)));
+    }
+}
+
+// Writes lhs * rhs into result, which must hold exactly lhs.size() + rhs.size() limbs.
+void mulLimbs(std::span<const Chunk> lhs, std::span<const Chunk> rhs, std::span<Chunk> result) {
+    if (lhs.size() < rhs.size()) {
+        std::swap(lhs, rhs);
+    }
+    const Thresholds thresholds = getThresholds();
+    if (isSameLimbs(lhs, rhs) && lhs.size() < thresholds.sqrKaratsuba) {
+        sqrSchoolbook(lhs, result);
+    } else if (!isSameLimbs(lhs, rhs) && rhs.size() < thresholds.karatsuba) {
+        mulSchoolbook(lhs, rhs, result);
+    } else if (lhs.size() >= 2 * rhs.size()) {
+        mulUnbalanced(lhs, rhs, result);
+    } else if (rhs.size() >= thresholds.toom4 && fitsToom<4>(lhs, rhs)) {
+        toomCook(lhs, rhs, result, TOOM4);
+    } else if (rhs.size() >= thresholds.toom3 && fitsToom<3>(lhs, rhs)) {
+        toomCook(lhs, rhs, result, TOOM3);
+    } else {
+        karatsuba(lhs, rhs, result);
     }
-    return BigUInt{removeTrailingZeros(limbs)};
 }
 
-uint64_t modPow(uint64_t base, uint64_t exp, uint64_t mod) {
+BigUInt recursiveMul(const BigUInt& multiplicand, const BigUInt& multiplier) {
+    const std::vector<Chunk>& lhsLimbs = getLimbs(multiplicand);
+    const std::vector<Chunk>& rhsLimbs = getLimbs(multiplier);
+    std::vector<Chunk> limbs(lhsLimbs.size() + rhsLimbs.size());
+    mulLimbs(lhsLimbs, rhsLimbs, limbs);
+    normalize(limbs);
+    return BigUInt{std::move(limbs)};
+}
+
+// All NTT primes are below 2^31, so residue products fit into 64 bits.
+constexpr uint64_t modPow(uint64_t base, uint64_t exp, uint64_t mod) {
     uint64_t result = 1;
     base %= mod;
     while (exp > 0) {
-        if ((exp & (uint8_t)1) != 0U) {
-            result = (__uint128_t)result * base % mod;
+        if ((exp & 1U) != 0U) {
+            result = result * base % mod;
         }
-        base = (__uint128_t)base * base % mod;
-        exp >>= (uint8_t)1;
+        base = base * base % mod;
+        exp >>= 1U;
     }
     return result;
 }
 
-uint64_t modInverse(uint64_t number, uint64_t mod) {
+constexpr uint64_t modInverse(uint64_t number, uint64_t mod) {
     return modPow(number, mod - 2, mod);
 }
 
-void ntt(std::vector<uint64_t>& number, bool invert) {
-    size_t size = number.size();
-    for (size_t i = 1, element = 0; i < size; i++) {
-        size_t bit = size >> (uint8_t)1;
-        for (; (element & bit) != 0U; bit >>= (uint8_t)1) {
-            element ^= bit;
-        }
-        element ^= bit;
-        if (i < element) {
-            std::swap(number[i], number[element]);
+// Garner coefficients: GARNER_INVERSES[i][k] = NTT_PRIMES[i]^-1 mod NTT_PRIMES[k] for i < k.
+constexpr auto GARNER_INVERSES = [] {
+    std::array<std::array<uint64_t, NTT_PRIME_COUNT>, NTT_PRIME_COUNT> inverses{};
+    for (size_t i = 0; i < NTT_PRIME_COUNT; ++i) {
+        for (size_t k = i + 1; k < NTT_PRIME_COUNT; ++k) {
+            inverses[i][k] = modInverse(NTT_PRIMES[i].modulus, NTT_PRIMES[k].modulus);
         }
     }
-    for (size_t len = 2; len <= size; len <<= (uint8_t)1) {
-        uint64_t wlen = modPow(NTT_ROOT, (NTT_MOD - 1) / len, NTT_MOD);
-        if (invert) {
-            wlen = modInverse(wlen, NTT_MOD);
-        }
-        for (size_t i = 0; i < size; i += len) {
-            uint64_t first = 1;
-            for (size_t j = 0; j < len / 2; j++) {
-                uint64_t second = number[i + j];
-                uint64_t third = (__uint128_t)number[i + j + (len / 2)] * first % NTT_MOD;
-                number[i + j] = (second + third) % NTT_MOD;
-                number[i + j + (len / 2)] = (second - third + NTT_MOD) % NTT_MOD;
-                first = (__uint128_t)first * wlen % NTT_MOD;
-            }
-        }
-    }
-    if (invert) {
-        uint64_t nInv = modInverse(size, NTT_MOD);
-        for (auto& chunk : number) {
-            chunk = (__uint128_t)chunk * nInv % NTT_MOD;
-        }
-    }
-}
+    return inverses;
+}();
 
 size_t nextPowerOf2(size_t n) {
     size_t power = 1;
     while (power < n) {
-        power <<= (uint8_t)1;
+        power <<= 1U;
     }
     return power;
 }
 
-std::vector<uint64_t> chunksToNTT(const std::vector<Chunk>& chunks) {
-    std::vector<uint64_t> result;
-    result.reserve(chunks.size() * 2);
-    for (const Chunk& chunk : chunks) {
-        result.push_back(chunk & 0xFFFFFFFFULL);
-        result.push_back((chunk >> (uint8_t)32) & 0xFFFFFFFFULL);
+// The modulus is a template parameter so that the reduction compiles to a multiplication.
+template <size_t PrimeIndex>
+void toResidues(std::span<const Chunk> limbs, std::span<Residue> residues) {
+    constexpr uint64_t MODULUS = NTT_PRIMES[PrimeIndex].modulus;
+    for (size_t i = 0; i < limbs.size(); ++i) {
+        residues[i] = static_cast<Residue>(limbs[i] % MODULUS);
     }
-    return result;
+    std::fill(residues.begin() + static_cast<std::ptrdiff_t>(limbs.size()), residues.end(), 0);
 }
 
-std::vector<Chunk> nttToChunks(const std::vector<uint64_t>& nttResult) {
-    std::vector<Chunk> result;
-    result.reserve((nttResult.size() + 1) / 2);
-    uint64_t carry = 0;
-    for (size_t i = 0; i < nttResult.size(); i += 2) {
-        uint64_t low = (i < nttResult.size()) ? nttResult[i] : 0;
-        uint64_t high = (i + 1 < nttResult.size()) ? nttResult[i + 1] : 0;
-        low += carry;
-        carry = low >> (uint8_t)32;
-        low &= 0xFFFFFFFFULL;
-        high += carry;
-        carry = high >> (uint8_t)32;
-        high &= 0xFFFFFFFFULL;
-        Chunk chunk = low | (high << (uint8_t)32);
-        result.push_back(chunk);
-    }
-    while (carry > 0) {
-        result.push_back(static_cast<Chunk>(carry));
-        carry = 0;
+template <size_t... PrimeIndices>
+constexpr auto makeResidueReducers(std::index_sequence<PrimeIndices...> /*indices*/) {
+    return std::array{&toResidues<PrimeIndices>...};
+}
+
+constexpr auto RESIDUE_REDUCERS = makeResidueReducers(std::make_index_sequence<NTT_PRIME_COUNT>{});
+
+// Rebuilds one convolution coefficient from its residues with Garner's algorithm and returns it
+// as three base-10^19 limbs. The mixed-radix digits are folded from the top: all but the lowest
+// fit into 128 bits, and the last step by NTT_PRIMES[0] is done in base 10^19.
+std::array<Chunk, 3> crtToLimbs(const std::array<Residue, NTT_PRIME_COUNT>& residues) {
+    std::array<uint64_t, NTT_PRIME_COUNT> digits{};
+    for (size_t k = 0; k < NTT_PRIME_COUNT; ++k) {
+        const uint64_t mod = NTT_PRIMES[k].modulus;
+        uint64_t digit = residues[k];
+        for (size_t i = 0; i < k; ++i) {
+            digit = (digit + mod - digits[i] % mod) % mod * GARNER_INVERSES[i][k] % mod;
+        }
+        digits[k] = digit;
     }
-    return result;
+    WideChunk upper = digits[NTT_PRIME_COUNT - 1];
+    for (size_t k = NTT_PRIME_COUNT - 1; k-- > 1;) {
+        upper = (upper * NTT_PRIMES[k].modulus) + digits[k];
+    }
+    std::array<Chunk, 3> limbs{};
+    Chunk upperLow = 0;
+    Chunk upperHigh = divModBase(upper, upperLow);
+    const WideChunk firstMod = NTT_PRIMES[0].modulus;
+    Chunk carry = divModBase((firstMod * upperLow) + digits[0], limbs[0]);
+    limbs[2] = divModBase((firstMod * upperHigh) + carry, limbs[1]);
+    return limbs;
 }
 
+using Spectra = std::vector<std::vector<Residue>>;
+
+Spectra transformOperand(std::span<const Chunk> limbs, size_t powerSize, size_t threadCount) {
+    Spectra spectra(NTT_PRIME_COUNT, std::vector<Residue>(powerSize));
+    parallelFor(NTT_PRIME_COUNT, threadCount, [&](size_t k) {
+        RESIDUE_REDUCERS[k](limbs, spectra[k]);
+        forwardNtt(spectra[k], k);
+    });
+    return spectra;
+}
+
+// Multiplies lhs by an operand of rhsSize limbs given by its forward transforms of powerSize
+// points, cutting lhs into blocks that fit the transform next to it. Without spectra lhs, which
+// must then fit into one block, is squared. With several threads, the transforms of a group of
+// blocks run concurrently, one task per block and prime, and the coefficients are rebuilt in
+// parallel before they are added into the result in order.
+BigUInt mulBySpectra(std::span<const Chunk> lhs, size_t rhsSize, size_t powerSize,
+                     const Spectra& rhsSpectra, size_t threadCount) {
+    size_t blockSize = powerSize - rhsSize + 1;
+    size_t blockCount = (lhs.size() + blockSize - 1) / blockSize;
+    size_t groupSize = std::min(blockCount, (threadCount + NTT_PRIME_COUNT - 1) / NTT_PRIME_COUNT);
+    std::vector<Chunk> resultChunks(lhs.size() + rhsSize + 2, 0);
+    Spectra convolutions(groupSize * NTT_PRIME_COUNT);
+    std::vector<std::array<Chunk, 3>> coefficients;
+    for (size_t firstBlock = 0; firstBlock < blockCount; firstBlock += groupSize) {
+        size_t groupBlocks = std::min(groupSize, blockCount - firstBlock);
+        auto blockAt = [&](size_t index) {
+            size_t begin = (firstBlock + index) * blockSize;
+            return lhs.subspan(begin, std::min(blockSize, lhs.size() - begin));
+        };
+        parallelFor(groupBlocks * NTT_PRIME_COUNT, threadCount, [&](size_t task) {
+            size_t k = task % NTT_PRIME_COUNT;
+            std::vector<Residue>& left = convolutions[task];
+            left.resize(powerSize);
+            RESIDUE_REDUCERS[k](blockAt(task / NTT_PRIME_COUNT), left);
+            forwardNtt(left, k);
+            pointwiseMul(left, rhsSpectra.empty() ? left : rhsSpectra[k], k);
+            inverseNtt(left, k);
+        });
+        for (size_t index = 0; index < groupBlocks; ++index) {
+            size_t count = blockAt(index).size() + rhsSize - 1;
+            coefficients.resize(count);
+            size_t rangeSize = (count + threadCount - 1) / threadCount;
+            parallelFor(threadCount, threadCount, [&](size_t range) {
+                std::array<Residue, NTT_PRIME_COUNT> residues{};
+                for (size_t i = range * rangeSize; i < std::min(count, (range + 1) * rangeSize);
+                     ++i) {
+                    for (size_t k = 0; k < NTT_PRIME_COUNT; ++k) {
+                        residues[k] = convolutions[(index * NTT_PRIME_COUNT) + k][i];
+                    }
+                    coefficients[i] = crtToLimbs(residues);
+                }
+            });
+            size_t begin = (firstBlock + index) * blockSize;
+            for (size_t i = 0; i < count; ++i) {
+                addLimbs(std::span<Chunk>(resultChunks).subspan(begin + i), coefficients[i]);
+            }
+        }
+    }
+    normalize(resultChunks);
+    return BigUInt{std::move(resultChunks)};
+}
+
+// The shorter operand is transformed once per prime. The longer one is cut into blocks that fill
+// a transform of at most four times the shorter length, so a very unbalanced product costs
+// a number of small transforms instead of one transform over the whole result. Without spectra the
+// longer operand is squared.
+BigUInt transformMul(std::span<const Chunk> lhs, std::span<const Chunk> rhs, bool square) {
+    size_t resultSize = lhs.size() + rhs.size() - 1;
+    size_t powerSize = std::min(nextPowerOf2(resultSize), nextPowerOf2(4 * rhs.size()));
+    size_t threadCount = threadsFor(rhs.size());
+    if (square) {
+        return mulBySpectra(lhs, rhs.size(), powerSize, {}, threadCount);
+    }
+    return mulBySpectra(lhs, rhs.size(), powerSize, transformOperand(rhs, powerSize, threadCount),
+                        threadCount);
+}
+
+// A shorter operand above nttPiece limbs would need a transform beyond MAX_NTT_SIZE, or one larger
+// than the caller wants, so it is cut into pieces of that size. Each piece multiplies the whole
+// longer operand and its product is added at the piece's offset.
 BigUInt nntMul(const BigUInt& multiplicand, const BigUInt& multiplier) {
-    const std::vector<Chunk>& lhsLimbs = getLimbs(multiplicand);
-    const std::vector<Chunk>& rhsLimbs = getLimbs(multiplier);
+    std::span<const Chunk> lhsLimbs = getLimbs(multiplicand);
+    std::span<const Chunk> rhsLimbs = getLimbs(multiplier);
     if (lhsLimbs.empty() || rhsLimbs.empty()) {
         return makeZero();
     }
-    if (lhsLimbs.size() + rhsLimbs.size() < 32) {
-        return simpleMul(multiplicand, multiplier);
-    }
-    std::vector<uint64_t> left = chunksToNTT(lhsLimbs);
-    std::vector<uint64_t> right = chunksToNTT(rhsLimbs);
-    size_t resultSize = left.size() + right.size() - 1;
-    size_t powerSize = nextPowerOf2(resultSize);
-    left.resize(powerSize, 0);
-    right.resize(powerSize, 0);
-    for (auto& chunk : left) {
-        chunk %= NTT_MOD;
+    if (lhsLimbs.size() < rhsLimbs.size()) {
+        std::swap(lhsLimbs, rhsLimbs);
     }
-    for (auto& chunk : right) {
-        chunk %= NTT_MOD;
+    size_t pieceSize = getThresholds().nttPiece;
+    if (rhsLimbs.size() <= pieceSize) {
+        return transformMul(lhsLimbs, rhsLimbs, &getLimbs(multiplicand) == &getLimbs(multiplier));
     }
-    ntt(left, false);
-    ntt(right, false);
-    for (size_t i = 0; i < powerSize; i++) {
-        left[i] = (__uint128_t)left[i] * right[i] % NTT_MOD;
+    std::vector<Chunk> limbs(lhsLimbs.size() + rhsLimbs.size(), 0);
+    for (size_t begin = 0; begin < rhsLimbs.size(); begin += pieceSize) {
+        std::span<const Chunk> piece =
+            rhsLimbs.subspan(begin, std::min(pieceSize, rhsLimbs.size() - begin));
+        piece = piece.first(significantSize(piece));
+        if (!piece.empty()) {
+            addLimbs(std::span<Chunk>(limbs).subspan(begin),
+                     getLimbs(transformMul(lhsLimbs, piece, false)));
+        }
     }
-    ntt(left, true);
-    left.resize(resultSize);
-    std::vector<Chunk> resultChunks = nttToChunks(left);
-    return BigUInt{removeTrailingZeros(resultChunks)};
+    normalize(limbs);
+    return BigUInt{std::move(limbs)};
 }
 
+bool prefersNtt(const BigUInt& multiplicand, const BigUInt& multiplier) {
+    // Blocked NTT reuses the spectrum of the shorter operand, so it pays off earlier for
+    // unbalanced products than for balanced ones.
+    const Thresholds thresholds = getThresholds();
+    size_t minSize = std::min(getSize(multiplicand), getSize(multiplier));
+    size_t maxSize = std::max(getSize(multiplicand), getSize(multiplier));
+    return minSize >= thresholds.ntt ||
+           (minSize >= thresholds.unbalancedNtt && maxSize >= 2 * minSize);
+}
 }  // namespace
 
 BigUInt mul(const BigUInt& multiplicand, const BigUInt& multiplier) noexcept {
     if (isZero(multiplicand) || isZero(multiplier)) {
         return makeZero();
     }
-    size_t maxByteLength = std::max(getByteLength(multiplicand), getByteLength(multiplier));
-    if (maxByteLength <= LARGE_BYTE_LENGTH) {
-        return simpleMul(multiplicand, multiplier);
+    if (prefersNtt(multiplicand, multiplier)) {
+        return nntMul(multiplicand, multiplier);
+    }
+    return recursiveMul(multiplicand, multiplier);
+}
+
+PreparedMul prepare(const BigUInt& operand) noexcept {
+    PreparedMul prepared{.operand = operand, .transformSize = 0, .spectra = {}};
+    size_t powerSize = nextPowerOf2(2 * getSize(operand));
+    if (getSize(operand) >= getThresholds().unbalancedNtt && powerSize <= MAX_NTT_SIZE) {
+        prepared.transformSize = powerSize;
+        prepared.spectra =
+            transformOperand(getLimbs(operand), powerSize, threadsFor(getSize(operand)));
+    }
+    return prepared;
+}
+
+BigUInt mul(const BigUInt& multiplicand, const PreparedMul& multiplier) noexcept {
+    // A factor much shorter than the prepared operand is cheaper to run through the blocked
+    // transform of its own size.
+    if (multiplier.spectra.empty() || isZero(multiplicand) ||
+        2 * getSize(multiplicand) < getSize(multiplier.operand) ||
+        !prefersNtt(multiplicand, multiplier.operand)) {
+        return mul(multiplicand, multiplier.operand);
+    }
+    size_t threadCount = threadsFor(std::min(getSize(multiplicand), getSize(multiplier.operand)));
+    return mulBySpectra(getLimbs(multiplicand), getSize(multiplier.operand),
+                        multiplier.transformSize, multiplier.spectra, threadCount);
+}
+
+void setMulParallelism(MulParallelism parallelism) noexcept {
+    parallelThreadCount.store(parallelism.threadCount, std::memory_order_relaxed);
+    parallelMinLimbs.store(parallelism.minLimbs, std::memory_order_relaxed);
+}
+
+MulParallelism getMulParallelism() noexcept {
+    return {.threadCount = parallelThreadCount.load(std::memory_order_relaxed),
+            .minLimbs = parallelMinLimbs.load(std::memory_order_relaxed)};
+}
+
+BigUInt sqr(const BigUInt& number) noexcept {
+    return mul(number, number);
+}
+
+void addMul(BigUInt& accumulator, const BigUInt& multiplicand, const BigUInt& multiplier) noexcept {
+    std::span<const Chunk> lhs = getLimbs(multiplicand);
+    std::span<const Chunk> rhs = getLimbs(multiplier);
+    lhs = lhs.first(significantSize(lhs));
+    rhs = rhs.first(significantSize(rhs));
+    if (lhs.empty() || rhs.empty()) {
+        return;
+    }
+    // Products that mul() would run through the schoolbook kernel anyway are added straight into
+    // the accumulator. Larger ones, and accumulators that are also a factor, need the product
+    // first.
+    bool aliased = &accumulator == &multiplicand || &accumulator == &multiplier;
+    if (aliased || std::min(lhs.size(), rhs.size()) >= getThresholds().karatsuba) {
+        addInPlace(accumulator, mul(multiplicand, multiplier));
+        return;
+    }
+    std::vector<Chunk>& limbs = accumulator.limbs;
+    limbs.resize(std::max(limbs.size(), lhs.size() + rhs.size()));
+    Chunk carry = addMulSchoolbook(lhs, rhs, limbs);
+    if (carry != 0) {
+        limbs.push_back(carry);
     }
-    return nntMul(multiplicand, multiplier);
+    normalize(limbs);
+}
+
+BigUInt fma(const BigUInt& multiplicand, const BigUInt& multiplier,
+            const BigUInt& addend) noexcept {
+    BigUInt result;
+    result.limbs.reserve(
+        std::max(getSize(addend), getSize(multiplicand) + getSize(multiplier)) + 1);
+    result.limbs.assign(addend.limbs.begin(), addend.limbs.end());
+    addMul(result, multiplicand, multiplier);
+    return result;
 }
 }  // namespace big_uint
@@ -0,0 +1,680 @@
+#include "ntt.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace big_uint {
+namespace {
+// Montgomery arithmetic with R = 2^32. Every prime is below 2^31, so sums of two reduced residues
+// still fit into a Residue.
+struct Montgomery {
+    Residue modulus;
+    Residue negInverse;
+    Residue rSquared;
+};
+
+constexpr Montgomery makeMontgomery(Residue modulus) {
+    Residue inverse = modulus;
+    for (int step = 0; step < 4; ++step) {
+        inverse *= 2 - (modulus * inverse);
+    }
+    auto rSquared = static_cast<Residue>((static_cast<__uint128_t>(1) << 64U) % modulus);
+    return {.modulus = modulus, .negInverse = 0 - inverse, .rSquared = rSquared};
+}
+
+constexpr auto MONTGOMERY = [] {
+    std::array<Montgomery, NTT_PRIME_COUNT> contexts{};
+    for (size_t index = 0; index < NTT_PRIME_COUNT; ++index) {
+        contexts[index] = makeMontgomery(NTT_PRIMES[index].modulus);
+    }
+    return contexts;
+}();
+
+inline Residue reduce(uint64_t value, const Montgomery& context) {
+    auto factor = static_cast<Residue>(value) * context.negInverse;
+    uint64_t sum = value + (static_cast<uint64_t>(factor) * context.modulus);
+    auto result = static_cast<Residue>(sum >> 32U);
+    return result - (context.modulus & (0 - static_cast<Residue>(result >= context.modulus)));
+}
+
+inline Residue mulMod(Residue lhs, Residue rhs, const Montgomery& context) {
+    return reduce(static_cast<uint64_t>(lhs) * rhs, context);
+}
+
+inline Residue addMod(Residue lhs, Residue rhs, const Montgomery& context) {
+    Residue sum = lhs + rhs;
+    return sum - (context.modulus & (0 - static_cast<Residue>(sum >= context.modulus)));
+}
+
+inline Residue subMod(Residue lhs, Residue rhs, const Montgomery& context) {
+    return lhs - rhs + (context.modulus & (0 - static_cast<Residue>(lhs < rhs)));
+}
+
+uint64_t powMod(uint64_t base, uint64_t exponent, uint64_t modulus) {
+    uint64_t result = 1;
+    base %= modulus;
+    while (exponent > 0) {
+        if ((exponent & 1U) != 0U) {
+            result = result * base % modulus;
+        }
+        base = base * base % modulus;
+        exponent >>= 1U;
+    }
+    return result;
+}
+
+// Twiddles in Montgomery form for one direction, laid out so that every level is contiguous and
+// a table built for one size also serves every smaller size:
+//   roots[half + i] = w_{2 * half}^i for i < half,
+//   cubes[quarter + i] = w_{4 * quarter}^{3i} for i < quarter,
+// with w the inverse roots of unity for the inverse transform.
+struct NttTables {
+    size_t size = 0;
+    std::vector<Residue> roots;
+    std::vector<Residue> cubes;
+};
+
+// Each level steps through its powers by Montgomery multiplication, so building a table costs
+// about as much as one pass of the transform over it.
+std::shared_ptr<const NttTables> buildTables(size_t primeIndex, size_t size, bool inverse) {
+    const Montgomery& context = MONTGOMERY[primeIndex];
+    const uint64_t modulus = context.modulus;
+    uint64_t root = NTT_PRIMES[primeIndex].root;
+    if (inverse) {
+        root = powMod(root, modulus - 2, modulus);
+    }
+    auto tables = std::make_shared<NttTables>();
+    tables->size = size;
+    tables->roots.assign(size, 0);
+    tables->cubes.assign(std::max<size_t>(size / 2, 1), 0);
+    const Residue one = mulMod(1, context.rSquared, context);
+    for (size_t half = 1; half < size; half <<= 1U) {
+        auto step = static_cast<Residue>(powMod(root, (modulus - 1) / (2 * half), modulus));
+        step = mulMod(step, context.rSquared, context);
+        Residue power = one;
+        for (size_t i = 0; i < half; ++i) {
+            tables->roots[half + i] = power;
+            if (half % 2 == 0 && i < half / 2) {
+                tables->cubes[(half / 2) + i] =
+                    mulMod(mulMod(power, power, context), power, context);
+            }
+            power = mulMod(power, step, context);
+        }
+    }
+    return tables;
+}
+
+constexpr size_t MAX_CACHED_TABLES = size_t{1} << 20U;
+
+// Tables of up to MAX_CACHED_TABLES points are kept for the life of the process, about 12 MB per
+// prime for both directions, and grow to the largest size asked for so far. Larger transforms
+// build their own tables and drop them when they finish, so the cache never holds the 2 GB that
+// transforms of MAX_NTT_SIZE would need. Tables are built outside the lock and only replace
+// smaller ones; readers keep their own reference, so a transform that is already running never
+// loses its tables.
+std::shared_ptr<const NttTables> getTables(size_t primeIndex, size_t size, bool inverse) {
+    static std::mutex mutex;
+    static std::array<std::array<std::shared_ptr<const NttTables>, NTT_PRIME_COUNT>, 2> cache;
+    std::shared_ptr<const NttTables>& cached = cache[inverse ? 1 : 0][primeIndex];
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (cached && cached->size >= size) {
+            return cached;
+        }
+    }
+    std::shared_ptr<const NttTables> tables = buildTables(primeIndex, size, inverse);
+    if (size > MAX_CACHED_TABLES) {
+        return tables;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!cached || cached->size < tables->size) {
+        cached = tables;
+    }
+    return cached;
+}
+
+// Transform stages. A radix-4 stage works on blocks of 4 * quarter residues and fuses two radix-2
+// levels; the radix-2 stage is only needed once when the size is an odd power of two.
+void forwardRadix2Scalar(Residue* data, size_t half, const Residue* roots,
+                         const Montgomery& context) {
+    for (size_t i = 0; i < half; ++i) {
+        Residue first = data[i];
+        Residue second = data[i + half];
+        data[i] = addMod(first, second, context);
+        data[i + half] = mulMod(subMod(first, second, context), roots[half + i], context);
+    }
+}
+
+void forwardRadix4Scalar(Residue* data, size_t size, size_t quarter, const Residue* roots,
+                         const Residue* cubes, const Montgomery& context) {
+    Residue imaginary = roots[3 * quarter];
+    for (size_t block = 0; block < size; block += 4 * quarter) {
+        Residue* part = data + block;
+        for (size_t i = 0; i < quarter; ++i) {
+            Residue sumEven = addMod(part[i], part[i + (2 * quarter)], context);
+            Residue diffEven = subMod(part[i], part[i + (2 * quarter)], context);
+            Residue sumOdd = addMod(part[i + quarter], part[i + (3 * quarter)], context);
+            Residue diffOdd = mulMod(subMod(part[i + quarter], part[i + (3 * quarter)], context),
+                                     imaginary, context);
+            part[i] = addMod(sumEven, sumOdd, context);
+            part[i + quarter] =
+                mulMod(subMod(sumEven, sumOdd, context), roots[quarter + i], context);
+            part[i + (2 * quarter)] =
+                mulMod(addMod(diffEven, diffOdd, context), roots[(2 * quarter) + i], context);
+            part[i + (3 * quarter)] =
+                mulMod(subMod(diffEven, diffOdd, context), cubes[quarter + i], context);
+        }
+    }
+}
+
+void inverseRadix4Scalar(Residue* data, size_t size, size_t quarter, const Residue* roots,
+                         const Residue* cubes, const Montgomery& context) {
+    Residue imaginary = roots[3 * quarter];
+    for (size_t block = 0; block < size; block += 4 * quarter) {
+        Residue* part = data + block;
+        for (size_t i = 0; i < quarter; ++i) {
+            Residue first = part[i];
+            Residue second = mulMod(part[i + quarter], roots[quarter + i], context);
+            Residue third = mulMod(part[i + (2 * quarter)], roots[(2 * quarter) + i], context);
+            Residue fourth = mulMod(part[i + (3 * quarter)], cubes[quarter + i], context);
+            Residue sumLow = addMod(first, second, context);
+            Residue diffLow = subMod(first, second, context);
+            Residue sumHigh = addMod(third, fourth, context);
+            Residue diffHigh = mulMod(subMod(third, fourth, context), imaginary, context);
+            part[i] = addMod(sumLow, sumHigh, context);
+            part[i + (2 * quarter)] = subMod(sumLow, sumHigh, context);
+            part[i + quarter] = addMod(diffLow, diffHigh, context);
+            part[i + (3 * quarter)] = subMod(diffLow, diffHigh, context);
+        }
+    }
+}
+
+void inverseRadix2Scalar(Residue* data, size_t half, const Residue* roots,
+                         const Montgomery& context) {
+    for (size_t i = 0; i < half; ++i) {
+        Residue first = data[i];
+        Residue second = mulMod(data[i + half], roots[half + i], context);
+        data[i] = addMod(first, second, context);
+        data[i + half] = subMod(first, second, context);
+    }
+}
+
+// target[i] = target[i] * source[i] * factor * R^-1, which is the exact product for factor = R^2.
+void mulPointwiseScalar(Residue* target, const Residue* source, size_t size, Residue factor,
+                        const Montgomery& context) {
+    for (size_t i = 0; i < size; ++i) {
+        target[i] = mulMod(mulMod(target[i], source[i], context), factor, context);
+    }
+}
+
+void scaleScalar(Residue* data, size_t size, Residue factor, const Montgomery& context) {
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = mulMod(data[i], factor, context);
+    }
+}
+
+#if defined(__x86_64__)
+// The vector kernels keep one residue per 32-bit lane. Montgomery products are formed separately
+// for even and odd lanes with a 32x32->64 multiply and blended back; min(x, x - p) replaces the
+// conditional subtraction. Stages narrower than a vector fall back to the scalar kernels.
+struct Avx2Field {
+    __m256i modulus;
+    __m256i negInverse;
+};
+
+__attribute__((target("avx2"))) inline Avx2Field makeAvx2Field(const Montgomery& context) {
+    return {.modulus = _mm256_set1_epi32(static_cast<int>(context.modulus)),
+            .negInverse = _mm256_set1_epi32(static_cast<int>(context.negInverse))};
+}
+
+// The unaligned loads and stores of the kernels, at base[index]. The intrinsics take vector
+// pointers to arbitrary residues, which only a cast and pointer arithmetic can form.
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+__attribute__((target("avx2"))) inline __m256i load(const Residue* base, size_t index) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(base + index));
+}
+
+__attribute__((target("avx2"))) inline void store(Residue* base, size_t index, __m256i value) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(base + index), value);
+}
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+__attribute__((target("avx2"))) inline __m256i addMod(__m256i lhs, __m256i rhs,
+                                                      const Avx2Field& field) {
+    __m256i sum = _mm256_add_epi32(lhs, rhs);
+    return _mm256_min_epu32(sum, _mm256_sub_epi32(sum, field.modulus));
+}
+
+__attribute__((target("avx2"))) inline __m256i subMod(__m256i lhs, __m256i rhs,
+                                                      const Avx2Field& field) {
+    __m256i diff = _mm256_sub_epi32(lhs, rhs);
+    return _mm256_min_epu32(diff, _mm256_add_epi32(diff, field.modulus));
+}
+
+// Leaves the reduced value in the upper half of every 64-bit lane.
+__attribute__((target("avx2"))) inline __m256i reduce(__m256i product, const Avx2Field& field) {
+    __m256i factor = _mm256_mul_epu32(product, field.negInverse);
+    return _mm256_add_epi64(product, _mm256_mul_epu32(factor, field.modulus));
+}
+
+__attribute__((target("avx2"))) inline __m256i mulMod(__m256i lhs, __m256i rhs,
+                                                      const Avx2Field& field) {
+    __m256i even = _mm256_srli_epi64(reduce(_mm256_mul_epu32(lhs, rhs), field), 32);
+    __m256i odd = reduce(
+        _mm256_mul_epu32(_mm256_srli_epi64(lhs, 32), _mm256_srli_epi64(rhs, 32)), field);
+    __m256i result = _mm256_blend_epi32(even, odd, 0xAA);
+    return _mm256_min_epu32(result, _mm256_sub_epi32(result, field.modulus));
+}
+
+constexpr size_t AVX2_LANES = 8;
+
+__attribute__((target("avx2"))) void forwardRadix2Avx2(Residue* data, size_t half,
+                                                       const Residue* roots,
+                                                       const Montgomery& context) {
+    if (half < AVX2_LANES) {
+        forwardRadix2Scalar(data, half, roots, context);
+        return;
+    }
+    const Avx2Field field = makeAvx2Field(context);
+    for (size_t i = 0; i < half; i += AVX2_LANES) {
+        __m256i first = load(data, i);
+        __m256i second = load(data, i + half);
+        store(data, i, addMod(first, second, field));
+        store(data, i + half, mulMod(subMod(first, second, field), load(roots, half + i), field));
+    }
+}
+
+__attribute__((target("avx2"))) void forwardRadix4Avx2(Residue* data, size_t size,
+                                                       size_t quarter, const Residue* roots,
+                                                       const Residue* cubes,
+                                                       const Montgomery& context) {
+    if (quarter < AVX2_LANES) {
+        forwardRadix4Scalar(data, size, quarter, roots, cubes, context);
+        return;
+    }
+    const Avx2Field field = makeAvx2Field(context);
+    const __m256i imaginary = _mm256_set1_epi32(static_cast<int>(roots[3 * quarter]));
+    for (size_t block = 0; block < size; block += 4 * quarter) {
+        Residue* part = data + block;
+        for (size_t i = 0; i < quarter; i += AVX2_LANES) {
+            __m256i first = load(part, i);
+            __m256i second = load(part, i + quarter);
+            __m256i third = load(part, i + (2 * quarter));
+            __m256i fourth = load(part, i + (3 * quarter));
+            __m256i sumEven = addMod(first, third, field);
+            __m256i diffEven = subMod(first, third, field);
+            __m256i sumOdd = addMod(second, fourth, field);
+            __m256i diffOdd = mulMod(subMod(second, fourth, field), imaginary, field);
+            store(part, i, addMod(sumEven, sumOdd, field));
+            store(part, i + quarter,
+                  mulMod(subMod(sumEven, sumOdd, field), load(roots, quarter + i), field));
+            store(part, i + (2 * quarter),
+                  mulMod(addMod(diffEven, diffOdd, field), load(roots, (2 * quarter) + i), field));
+            store(part, i + (3 * quarter),
+                  mulMod(subMod(diffEven, diffOdd, field), load(cubes, quarter + i), field));
+        }
+    }
+}
+
+__attribute__((target("avx2"))) void inverseRadix4Avx2(Residue* data, size_t size,
+                                                       size_t quarter, const Residue* roots,
+                                                       const Residue* cubes,
+                                                       const Montgomery& context) {
+    if (quarter < AVX2_LANES) {
+        inverseRadix4Scalar(data, size, quarter, roots, cubes, context);
+        return;
+    }
+    const Avx2Field field = makeAvx2Field(context);
+    const __m256i imaginary = _mm256_set1_epi32(static_cast<int>(roots[3 * quarter]));
+    for (size_t block = 0; block < size; block += 4 * quarter) {
+        Residue* part = data + block;
+        for (size_t i = 0; i < quarter; i += AVX2_LANES) {
+            __m256i first = load(part, i);
+            __m256i second = mulMod(load(part, i + quarter), load(roots, quarter + i), field);
+            __m256i third =
+                mulMod(load(part, i + (2 * quarter)), load(roots, (2 * quarter) + i), field);
+            __m256i fourth = mulMod(load(part, i + (3 * quarter)), load(cubes, quarter + i), field);
+            __m256i sumLow = addMod(first, second, field);
+            __m256i diffLow = subMod(first, second, field);
+            __m256i sumHigh = addMod(third, fourth, field);
+            __m256i diffHigh = mulMod(subMod(third, fourth, field), imaginary, field);
+            store(part, i, addMod(sumLow, sumHigh, field));
+            store(part, i + (2 * quarter), subMod(sumLow, sumHigh, field));
+            store(part, i + quarter, addMod(diffLow, diffHigh, field));
+            store(part, i + (3 * quarter), subMod(diffLow, diffHigh, field));
+        }
+    }
+}
+
+__attribute__((target("avx2"))) void inverseRadix2Avx2(Residue* data, size_t half,
+                                                       const Residue* roots,
+                                                       const Montgomery& context) {
+    if (half < AVX2_LANES) {
+        inverseRadix2Scalar(data, half, roots, context);
+        return;
+    }
+    const Avx2Field field = makeAvx2Field(context);
+    for (size_t i = 0; i < half; i += AVX2_LANES) {
+        __m256i first = load(data, i);
+        __m256i second = mulMod(load(data, i + half), load(roots, half + i), field);
+        store(data, i, addMod(first, second, field));
+        store(data, i + half, subMod(first, second, field));
+    }
+}
+
+__attribute__((target("avx2"))) void mulPointwiseAvx2(Residue* target, const Residue* source,
+                                                      size_t size, Residue factor,
+                                                      const Montgomery& context) {
+    const Avx2Field field = makeAvx2Field(context);
+    const __m256i factors = _mm256_set1_epi32(static_cast<int>(factor));
+    size_t i = 0;
+    for (; i + AVX2_LANES <= size; i += AVX2_LANES) {
+        __m256i product = mulMod(load(target, i), load(source, i), field);
+        store(target, i, mulMod(product, factors, field));
+    }
+    mulPointwiseScalar(target + i, source + i, size - i, factor, context);
+}
+
+__attribute__((target("avx2"))) void scaleAvx2(Residue* data, size_t size, Residue factor,
+                                               const Montgomery& context) {
+    const Avx2Field field = makeAvx2Field(context);
+    const __m256i factors = _mm256_set1_epi32(static_cast<int>(factor));
+    size_t i = 0;
+    for (; i + AVX2_LANES <= size; i += AVX2_LANES) {
+        store(data, i, mulMod(load(data, i), factors, field));
+    }
+    scaleScalar(data + i, size - i, factor, context);
+}
+
+struct Avx512Field {
+    __m512i modulus;
+    __m512i negInverse;
+};
+
+__attribute__((target("avx512f"))) inline Avx512Field makeAvx512Field(const Montgomery& context) {
+    return {.modulus = _mm512_set1_epi32(static_cast<int>(context.modulus)),
+            .negInverse = _mm512_set1_epi32(static_cast<int>(context.negInverse))};
+}
+
+// As load and store; the AVX-512 intrinsics take untyped pointers, so no cast is needed.
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+__attribute__((target("avx512f"))) inline __m512i loadWide(const Residue* base, size_t index) {
+    return _mm512_loadu_si512(base + index);
+}
+
+__attribute__((target("avx512f"))) inline void storeWide(Residue* base, size_t index,
+                                                         __m512i value) {
+    _mm512_storeu_si512(base + index, value);
+}
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+__attribute__((target("avx512f"))) inline __m512i addMod(__m512i lhs, __m512i rhs,
+                                                         const Avx512Field& field) {
+    __m512i sum = _mm512_add_epi32(lhs, rhs);
+    return _mm512_min_epu32(sum, _mm512_sub_epi32(sum, field.modulus));
+}
+
+__attribute__((target("avx512f"))) inline __m512i subMod(__m512i lhs, __m512i rhs,
+                                                         const Avx512Field& field) {
+    __m512i diff = _mm512_sub_epi32(lhs, rhs);
+    return _mm512_min_epu32(diff, _mm512_add_epi32(diff, field.modulus));
+}
+
+__attribute__((target("avx512f"))) inline __m512i reduce(__m512i product,
+                                                         const Avx512Field& field) {
+    __m512i factor = _mm512_mul_epu32(product, field.negInverse);
+    return _mm512_add_epi64(product, _mm512_mul_epu32(factor, field.modulus));
+}
+
+__attribute__((target("avx512f"))) inline __m512i mulMod(__m512i lhs, __m512i rhs,
+                                                         const Avx512Field& field) {
+    __m512i even = _mm512_srli_epi64(reduce(_mm512_mul_epu32(lhs, rhs), field), 32);
+    __m512i odd = reduce(
+        _mm512_mul_epu32(_mm512_srli_epi64(lhs, 32), _mm512_srli_epi64(rhs, 32)), field);
+    __m512i result = _mm512_mask_blend_epi32(0xAAAA, even, odd);
+    return _mm512_min_epu32(result, _mm512_sub_epi32(result, field.modulus));
+}
+
+constexpr size_t AVX512_LANES = 16;
+
+__attribute__((target("avx512f"))) void forwardRadix2Avx512(Residue* data, size_t half,
+                                                            const Residue* roots,
+                                                            const Montgomery& context) {
+    if (half < AVX512_LANES) {
+        forwardRadix2Scalar(data, half, roots, context);
+        return;
+    }
+    const Avx512Field field = makeAvx512Field(context);
+    for (size_t i = 0; i < half; i += AVX512_LANES) {
+        __m512i first = loadWide(data, i);
+        __m512i second = loadWide(data, i + half);
+        storeWide(data, i, addMod(first, second, field));
+        storeWide(data, i + half,
+                  mulMod(subMod(first, second, field), loadWide(roots, half + i), field));
+    }
+}
+
+__attribute__((target("avx512f"))) void forwardRadix4Avx512(Residue* data, size_t size,
+                                                            size_t quarter, const Residue* roots,
+                                                            const Residue* cubes,
+                                                            const Montgomery& context) {
+    if (quarter < AVX512_LANES) {
+        forwardRadix4Scalar(data, size, quarter, roots, cubes, context);
+        return;
+    }
+    const Avx512Field field = makeAvx512Field(context);
+    const __m512i imaginary = _mm512_set1_epi32(static_cast<int>(roots[3 * quarter]));
+    for (size_t block = 0; block < size; block += 4 * quarter) {
+        Residue* part = data + block;
+        for (size_t i = 0; i < quarter; i += AVX512_LANES) {
+            __m512i first = loadWide(part, i);
+            __m512i second = loadWide(part, i + quarter);
+            __m512i third = loadWide(part, i + (2 * quarter));
+            __m512i fourth = loadWide(part, i + (3 * quarter));
+            __m512i sumEven = addMod(first, third, field);
+            __m512i diffEven = subMod(first, third, field);
+            __m512i sumOdd = addMod(second, fourth, field);
+            __m512i diffOdd = mulMod(subMod(second, fourth, field), imaginary, field);
+            storeWide(part, i, addMod(sumEven, sumOdd, field));
+            storeWide(part, i + quarter, mulMod(subMod(sumEven, sumOdd, field),
+                                                 loadWide(roots, quarter + i), field));
+            storeWide(part, i + (2 * quarter), mulMod(addMod(diffEven, diffOdd, field),
+                                                       loadWide(roots, (2 * quarter) + i), field));
+            storeWide(part, i + (3 * quarter), mulMod(subMod(diffEven, diffOdd, field),
+                                                       loadWide(cubes, quarter + i), field));
+        }
+    }
+}
+
+__attribute__((target("avx512f"))) void inverseRadix4Avx512(Residue* data, size_t size,
+                                                            size_t quarter, const Residue* roots,
+                                                            const Residue* cubes,
+                                                            const Montgomery& context) {
+    if (quarter < AVX512_LANES) {
+        inverseRadix4Scalar(data, size, quarter, roots, cubes, context);
+        return;
+    }
+    const Avx512Field field = makeAvx512Field(context);
+    const __m512i imaginary = _mm512_set1_epi32(static_cast<int>(roots[3 * quarter]));
+    for (size_t block = 0; block < size; block += 4 * quarter) {
+        Residue* part = data + block;
+        for (size_t i = 0; i < quarter; i += AVX512_LANES) {
+            __m512i first = loadWide(part, i);
+            __m512i second =
+                mulMod(loadWide(part, i + quarter), loadWide(roots, quarter + i), field);
+            __m512i third = mulMod(loadWide(part, i + (2 * quarter)),
+                                   loadWide(roots, (2 * quarter) + i), field);
+            __m512i fourth = mulMod(loadWide(part, i + (3 * quarter)),
+                                    loadWide(cubes, quarter + i), field);
+            __m512i sumLow = addMod(first, second, field);
+            __m512i diffLow = subMod(first, second, field);
+            __m512i sumHigh = addMod(third, fourth, field);
+            __m512i diffHigh = mulMod(subMod(third, fourth, field), imaginary, field);
+            storeWide(part, i, addMod(sumLow, sumHigh, field));
+            storeWide(part, i + (2 * quarter), subMod(sumLow, sumHigh, field));
+            storeWide(part, i + quarter, addMod(diffLow, diffHigh, field));
+            storeWide(part, i + (3 * quarter), subMod(diffLow, diffHigh, field));
+        }
+    }
+}
+
+__attribute__((target("avx512f"))) void inverseRadix2Avx512(Residue* data, size_t half,
+                                                            const Residue* roots,
+                                                            const Montgomery& context) {
+    if (half < AVX512_LANES) {
+        inverseRadix2Scalar(data, half, roots, context);
+        return;
+    }
+    const Avx512Field field = makeAvx512Field(context);
+    for (size_t i = 0; i < half; i += AVX512_LANES) {
+        __m512i first = loadWide(data, i);
+        __m512i second = mulMod(loadWide(data, i + half), loadWide(roots, half + i), field);
+        storeWide(data, i, addMod(first, second, field));
+        storeWide(data, i + half, subMod(first, second, field));
+    }
+}
+
+__attribute__((target("avx512f"))) void mulPointwiseAvx512(Residue* target,
+                                                           const Residue* source, size_t size,
+                                                           Residue factor,
+                                                           const Montgomery& context) {
+    const Avx512Field field = makeAvx512Field(context);
+    const __m512i factors = _mm512_set1_epi32(static_cast<int>(factor));
+    size_t i = 0;
+    for (; i + AVX512_LANES <= size; i += AVX512_LANES) {
+        __m512i product = mulMod(loadWide(target, i), loadWide(source, i), field);
+        storeWide(target, i, mulMod(product, factors, field));
+    }
+    mulPointwiseScalar(target + i, source + i, size - i, factor, context);
+}
+
+__attribute__((target("avx512f"))) void scaleAvx512(Residue* data, size_t size, Residue factor,
+                                                    const Montgomery& context) {
+    const Avx512Field field = makeAvx512Field(context);
+    const __m512i factors = _mm512_set1_epi32(static_cast<int>(factor));
+    size_t i = 0;
+    for (; i + AVX512_LANES <= size; i += AVX512_LANES) {
+        storeWide(data, i, mulMod(loadWide(data, i), factors, field));
+    }
+    scaleScalar(data + i, size - i, factor, context);
+}
+#endif
+
+struct NttKernels {
+    void (*forwardRadix2)(Residue*, size_t, const Residue*, const Montgomery&);
+    void (*forwardRadix4)(Residue*, size_t, size_t, const Residue*, const Residue*,
+                          const Montgomery&);
+    void (*inverseRadix4)(Residue*, size_t, size_t, const Residue*, const Residue*,
+                          const Montgomery&);
+    void (*inverseRadix2)(Residue*, size_t, const Residue*, const Montgomery&);
+    void (*mulPointwise)(Residue*, const Residue*, size_t, Residue, const Montgomery&);
+    void (*scale)(Residue*, size_t, Residue, const Montgomery&);
+};
+
+constexpr NttKernels SCALAR_KERNELS = {
+    .forwardRadix2 = forwardRadix2Scalar,
+    .forwardRadix4 = forwardRadix4Scalar,
+    .inverseRadix4 = inverseRadix4Scalar,
+    .inverseRadix2 = inverseRadix2Scalar,
+    .mulPointwise = mulPointwiseScalar,
+    .scale = scaleScalar,
+};
+
+#if defined(__x86_64__)
+constexpr NttKernels AVX2_KERNELS = {
+    .forwardRadix2 = forwardRadix2Avx2,
+    .forwardRadix4 = forwardRadix4Avx2,
+    .inverseRadix4 = inverseRadix4Avx2,
+    .inverseRadix2 = inverseRadix2Avx2,
+    .mulPointwise = mulPointwiseAvx2,
+    .scale = scaleAvx2,
+};
+
+constexpr NttKernels AVX512_KERNELS = {
+    .forwardRadix2 = forwardRadix2Avx512,
+    .forwardRadix4 = forwardRadix4Avx512,
+    .inverseRadix4 = inverseRadix4Avx512,
+    .inverseRadix2 = inverseRadix2Avx512,
+    .mulPointwise = mulPointwiseAvx512,
+    .scale = scaleAvx512,
+};
+#endif
+
+// Chosen once from CPUID, so the library runs on any x86-64 machine regardless of build flags.
+const NttKernels& selectKernels() {
+#if defined(__x86_64__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return AVX512_KERNELS;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return AVX2_KERNELS;
+    }
+#endif
+    return SCALAR_KERNELS;
+}
+
+const NttKernels& getKernels() {
+    static const NttKernels& kernels = selectKernels();
+    return kernels;
+}
+}  // namespace
+
+void forwardNtt(std::span<Residue> values, size_t primeIndex) {
+    size_t size = values.size();
+    if (size < 2) {
+        return;
+    }
+    const Montgomery& context = MONTGOMERY[primeIndex];
+    const NttKernels& kernels = getKernels();
+    std::shared_ptr<const NttTables> tables = getTables(primeIndex, size, false);
+    const Residue* roots = tables->roots.data();
+    const Residue* cubes = tables->cubes.data();
+
+    size_t length = size;
+    if (std::countr_zero(size) % 2 != 0) {
+        length = size / 2;
+        kernels.forwardRadix2(values.data(), length, roots, context);
+    }
+    for (; length >= 4; length /= 4) {
+        kernels.forwardRadix4(values.data(), size, length / 4, roots, cubes, context);
+    }
+}
+
+void inverseNtt(std::span<Residue> values, size_t primeIndex) {
+    size_t size = values.size();
+    if (size < 2) {
+        return;
+    }
+    const Montgomery& context = MONTGOMERY[primeIndex];
+    const NttKernels& kernels = getKernels();
+    std::shared_ptr<const NttTables> tables = getTables(primeIndex, size, true);
+    const Residue* roots = tables->roots.data();
+    const Residue* cubes = tables->cubes.data();
+
+    size_t length = 4;
+    for (; length <= size; length *= 4) {
+        kernels.inverseRadix4(values.data(), size, length / 4, roots, cubes, context);
+    }
+    if (length / 4 < size) {
+        kernels.inverseRadix2(values.data(), size / 2, roots, context);
+    }
+    auto sizeInverse = static_cast<Residue>(powMod(size, context.modulus - 2, context.modulus));
+    kernels.scale(values.data(), size, mulMod(sizeInverse, context.rSquared, context), context);
+}
+
+void pointwiseMul(std::span<Residue> target, std::span<const Residue> source, size_t primeIndex) {
+    const Montgomery& context = MONTGOMERY[primeIndex];
+    getKernels().mulPointwise(target.data(), source.data(), target.size(), context.rSquared,
+                              context);
+}
+}  // namespace big_uint
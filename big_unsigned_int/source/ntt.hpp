@@ -0,0 +1,36 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace big_uint {
+using Residue = uint32_t;
+
+struct NttPrime {
+    Residue modulus;
+    Residue root;
+};
+
+// Products are convolved over whole limbs modulo five primes of the form c * 2^k + 1 with k >= 25.
+// Their product exceeds 2^153, which bounds every coefficient min(n, m) * (10^19 - 1)^2 as long as
+// the transform length stays within MAX_NTT_SIZE.
+constexpr size_t NTT_PRIME_COUNT = 5;
+constexpr std::array<NttPrime, NTT_PRIME_COUNT> NTT_PRIMES = {{
+    {.modulus = 2113929217U, .root = 5},
+    {.modulus = 2013265921U, .root = 31},
+    {.modulus = 1811939329U, .root = 13},
+    {.modulus = 1711276033U, .root = 29},
+    {.modulus = 1107296257U, .root = 10},
+}};
+constexpr size_t MAX_NTT_SIZE = size_t{1} << 25U;
+
+// The forward transform leaves the spectrum in bit-reversed order and the inverse transform takes
+// it in that order, so products never need a permutation pass. Sizes must be powers of two.
+void forwardNtt(std::span<Residue> values, size_t primeIndex);
+
+void inverseNtt(std::span<Residue> values, size_t primeIndex);
+
+void pointwiseMul(std::span<Residue> target, std::span<const Residue> source, size_t primeIndex);
+}  // namespace big_uint
@@ -0,0 +1,228 @@
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "big_uint.hpp"
+#include "limbs.hpp"
+
+namespace big_uint {
+namespace {
+constexpr unsigned WORD_BITS = 63;
+constexpr Chunk WORD_DIVISOR = Chunk{1} << WORD_BITS;
+
+// Exponent bit lengths from which each window width pays for its table of odd powers: a window of
+// w bits costs 2^(w-1) multiplications up front and saves about one multiplication per w + 1 bits.
+constexpr std::array<size_t, 6> WINDOW_BITS = {24, 80, 240, 672, 1792, 4608};
+
+// The exponent in binary, WORD_BITS bits per word with the lowest word first. Each word is one pass
+// of division by 2^63, which is cheap next to the modular multiplications it drives.
+class ExponentBits {
+public:
+    explicit ExponentBits(std::span<const Chunk> exponent) {
+        std::vector<Chunk> limbs(exponent.begin(), exponent.end());
+        while (!limbs.empty()) {
+            words.push_back(divSmallLimbs(limbs, WORD_DIVISOR));
+            normalize(limbs);
+        }
+        bitLength = words.empty() ? 0 : ((words.size() - 1) * WORD_BITS) +
+                                             static_cast<size_t>(std::bit_width(words.back()));
+    }
+
+    [[nodiscard]] size_t size() const {
+        return bitLength;
+    }
+
+    [[nodiscard]] unsigned get(size_t index) const {
+        return static_cast<unsigned>((words[index / WORD_BITS] >> (index % WORD_BITS)) & 1U);
+    }
+
+private:
+    std::vector<Chunk> words;
+    size_t bitLength = 0;
+};
+
+unsigned windowWidth(size_t bitLength) {
+    unsigned width = 1;
+    for (size_t bits : WINDOW_BITS) {
+        width += bitLength > bits ? 1U : 0U;
+    }
+    return width;
+}
+
+// Residues kept as they are, multiplied with Barrett reduction.
+struct BarrettDomain {
+    const ModContext& context;
+
+    [[nodiscard]] BigUInt enter(const BigUInt& number) const {
+        return reduce(context, number);
+    }
+
+    [[nodiscard]] BigUInt leave(const BigUInt& number) const {
+        return number;
+    }
+
+    [[nodiscard]] BigUInt mul(const BigUInt& lhs, const BigUInt& rhs) const {
+        return mulMod(context, lhs, rhs);
+    }
+
+    [[nodiscard]] BigUInt sqr(const BigUInt& number) const {
+        return sqrMod(context, number);
+    }
+};
+
+// Residues in Montgomery form, whose reduction needs no correction loop.
+struct MontgomeryDomain {
+    const ModContext& context;
+
+    [[nodiscard]] BigUInt enter(const BigUInt& number) const {
+        return toMontgomery(context, number);
+    }
+
+    [[nodiscard]] BigUInt leave(const BigUInt& number) const {
+        return fromMontgomery(context, number);
+    }
+
+    [[nodiscard]] BigUInt mul(const BigUInt& lhs, const BigUInt& rhs) const {
+        return montgomeryMul(context, lhs, rhs);
+    }
+
+    [[nodiscard]] BigUInt sqr(const BigUInt& number) const {
+        return montgomerySqr(context, number);
+    }
+};
+
+// Left-to-right sliding window over a nonzero exponent. The table holds base^1, base^3, ...,
+// base^(2^w - 1); every window is a run of at most w bits that starts and ends with a one, so it
+// costs one table multiplication after squarings, and runs of zeros cost squarings only.
+template <typename Domain>
+BigUInt slidingWindowPow(const Domain& domain, const BigUInt& base, const ExponentBits& bits) {
+    unsigned width = windowWidth(bits.size());
+    std::vector<BigUInt> oddPowers(size_t{1} << (width - 1));
+    oddPowers[0] = domain.enter(base);
+    if (oddPowers.size() > 1) {
+        BigUInt square = domain.sqr(oddPowers[0]);
+        for (size_t index = 1; index < oddPowers.size(); ++index) {
+            oddPowers[index] = domain.mul(oddPowers[index - 1], square);
+        }
+    }
+
+    BigUInt result;
+    bool started = false;
+    for (size_t position = bits.size(); position > 0;) {
+        if (bits.get(position - 1) == 0) {
+            result = domain.sqr(result);
+            --position;
+            continue;
+        }
+        size_t low = position > width ? position - width : 0;
+        while (bits.get(low) == 0) {
+            ++low;
+        }
+        size_t window = 0;
+        for (size_t index = position; index-- > low;) {
+            window = (window << 1U) | bits.get(index);
+        }
+        if (started) {
+            for (size_t step = low; step < position; ++step) {
+                result = domain.sqr(result);
+            }
+            result = domain.mul(result, oddPowers[window >> 1U]);
+        } else {
+            result = oddPowers[window >> 1U];
+            started = true;
+        }
+        position = low;
+    }
+    return domain.leave(result);
+}
+
+// A modulus of one limb keeps every residue in a machine word, and a product of two residues is
+// reduced by the modulus's reciprocal without building a BigUInt.
+Chunk powModWord(const BigUInt& base, const ExponentBits& bits, Chunk modulus) {
+    auto shift = static_cast<unsigned>(std::countl_zero(modulus));
+    Chunk normalized = modulus << shift;
+    Chunk reciprocal = reciprocalOf(normalized);
+    auto mulModWord = [&](Chunk lhs, Chunk rhs) {
+        Chunk remainder = 0;
+        divModWide((static_cast<WideChunk>(lhs) * rhs) << shift, normalized, reciprocal, remainder);
+        return remainder >> shift;
+    };
+    std::span<const Chunk> limbs = significantLimbs(base);
+    std::vector<Chunk> quotient(limbs.begin(), limbs.end());
+    Chunk power = divSmallLimbs(quotient, modulus);
+    Chunk result = 1;
+    for (size_t position = bits.size(); position-- > 0;) {
+        result = mulModWord(result, result);
+        if (bits.get(position) != 0) {
+            result = mulModWord(result, power);
+        }
+    }
+    return result;
+}
+}  // namespace
+
+BigUInt pow(const BigUInt& base, uint64_t exponent) noexcept {
+    if (exponent == 0) {
+        return BigUInt{{1}};
+    }
+    std::span<const Chunk> limbs = significantLimbs(base);
+    if (limbs.empty()) {
+        return makeZero();
+    }
+    // Zero limbs at the bottom are factors of BASE and only shift the power.
+    auto zeroLimbs = static_cast<size_t>(
+        std::find_if(limbs.begin(), limbs.end(), [](Chunk limb) { return limb != 0; }) -
+        limbs.begin());
+    std::span<const Chunk> factor = limbs.subspan(zeroLimbs);
+    size_t shift = zeroLimbs * exponent;
+    if (factor.size() == 1) {
+        const auto* power = std::find(POWERS_OF_TEN.begin(), POWERS_OF_TEN.end(), factor[0]);
+        if (power != POWERS_OF_TEN.end()) {
+            // 10^(d * exponent) is whole limbs of zeros under one power of ten below BASE, so the
+            // result is allocated once at its final size.
+            uint64_t digits = static_cast<uint64_t>(power - POWERS_OF_TEN.begin()) * exponent;
+            std::vector<Chunk> result(shift + (digits / MAX_VALUE_LENGTH) + 1);
+            result.back() = POWERS_OF_TEN[digits % MAX_VALUE_LENGTH];
+            return BigUInt{std::move(result)};
+        }
+    }
+    BigUInt factorNumber = fromLimbs(factor);
+    BigUInt result = factorNumber;
+    for (auto bit = static_cast<unsigned>(std::bit_width(exponent)) - 1; bit-- > 0;) {
+        result = sqr(result);
+        if (((exponent >> bit) & 1U) != 0) {
+            result = factor.size() == 1 ? mulSmall(result, factor[0]) : mul(result, factorNumber);
+        }
+    }
+    return shift == 0 ? result : shiftUp(result, shift);
+}
+
+BigUInt powMod(const ModContext& context, const BigUInt& base, const BigUInt& exponent) noexcept {
+    std::span<const Chunk> modulus = significantLimbs(context.modulus);
+    if (modulus.empty() || (modulus.size() == 1 && modulus[0] == 1)) {
+        return makeZero();
+    }
+    ExponentBits bits(significantLimbs(exponent));
+    if (bits.size() == 0) {
+        return BigUInt{{1}};
+    }
+    if (modulus.size() == 1) {
+        std::vector<Chunk> result = {powModWord(base, bits, modulus[0])};
+        normalize(result);
+        return BigUInt{std::move(result)};
+    }
+    if (context.hasMontgomery) {
+        return slidingWindowPow(MontgomeryDomain{context}, base, bits);
+    }
+    return slidingWindowPow(BarrettDomain{context}, base, bits);
+}
+
+BigUInt powMod(const BigUInt& base, const BigUInt& exponent, const BigUInt& modulus) noexcept {
+    return powMod(makeModContext(modulus), base, exponent);
+}
+}  // namespace big_uint
@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+
+#include "big_uint.hpp"
+#include "limbs.hpp"
+
+namespace big_uint {
+namespace {
+// Added to the logarithm of the estimated root; far above the rounding of a double logarithm, so
+// the estimate never falls below the root.
+constexpr double LOG_MARGIN = 1e-9;
+// Digits kept in the mantissa of the estimate, so that it fits in a machine word.
+constexpr double MANTISSA_DIGITS = 17;
+constexpr size_t LIMB_BITS = std::numeric_limits<Chunk>::digits;
+
+// At least the bit length of a nonzero number: a full word for each limb below the top one.
+size_t bitLengthBound(std::span<const Chunk> limbs) {
+    return ((limbs.size() - 1) * LIMB_BITS) + static_cast<size_t>(std::bit_width(limbs.back()));
+}
+
+// An upper bound on the root within a relative 10^-8, from the top two limbs of the number.
+BigUInt estimateRoot(std::span<const Chunk> limbs, uint64_t degree) {
+    size_t size = limbs.size();
+    double top = static_cast<double>(limbs[size - 1]);
+    if (size > 1) {
+        top = (top * static_cast<double>(BASE)) + static_cast<double>(limbs[size - 2]);
+    }
+    size_t lowLimbs = size - std::min<size_t>(size, 2);
+    double digits = std::log10(top) + static_cast<double>(MAX_VALUE_LENGTH * lowLimbs);
+    double rootDigits = (digits / static_cast<double>(degree)) + LOG_MARGIN;
+    double exponent = std::max(0.0, std::floor(rootDigits) - MANTISSA_DIGITS);
+    auto mantissa = static_cast<uint64_t>(std::pow(10.0, rootDigits - exponent)) + 1;
+    return mulSmall(pow(BigUInt{{10}}, static_cast<uint64_t>(exponent)), mantissa);
+}
+
+// Newton's step for x^degree = number, ((degree - 1) * x + number / x^(degree - 1)) / degree. From
+// any start at or above the root every step stays at or above floor(root), so the first step whose
+// power does not exceed the number has reached it. A step that lands one above, the usual miss
+// from a good start, is settled by trying one less instead of by another division.
+BigUInt refineRoot(const BigUInt& number, uint64_t degree, BigUInt root) {
+    while (true) {
+        BigUInt quotient = divMod(number, pow(root, degree - 1)).quotient;
+        root = divModSmall(add(mulSmall(root, degree - 1), quotient), degree).quotient;
+        if (isLowerOrEqual(pow(root, degree), number)) {
+            return root;
+        }
+        root = subSmall(root, 1);
+        if (isLowerOrEqual(pow(root, degree), number)) {
+            return root;
+        }
+    }
+}
+
+// The root of the top limbs of the number, dropping a multiple of degree limbs so that about half
+// remain, gives the root to about half its limbs; scaled back up and rounded above, it is a start
+// from which one Newton step nearly always lands on the answer.
+BigUInt rootOf(const BigUInt& number, uint64_t degree) {
+    size_t size = getSize(number);
+    size_t droppedRootLimbs = size / 2 / degree;
+    if (droppedRootLimbs == 0) {
+        return refineRoot(number, degree, estimateRoot(significantLimbs(number), degree));
+    }
+    BigUInt top = round(number, size - (droppedRootLimbs * degree));
+    BigUInt start = shiftUp(addSmall(rootOf(top, degree), 1), droppedRootLimbs);
+    return refineRoot(number, degree, std::move(start));
+}
+}  // namespace
+
+BigUInt iroot(const BigUInt& number, uint64_t degree) noexcept {
+    BigUInt trimmed = fromLimbs(significantLimbs(number));
+    if (degree == 0 || isZero(trimmed)) {
+        return makeZero();
+    }
+    if (degree == 1) {
+        return trimmed;
+    }
+    // 2^degree is above a number of at most degree bits, so its root is 1. Newton's steps would
+    // raise their start to nearly that power before finding it.
+    if (degree >= bitLengthBound(significantLimbs(trimmed))) {
+        return BigUInt{{1}};
+    }
+    return rootOf(trimmed, degree);
+}
+
+BigUInt isqrt(const BigUInt& number) noexcept {
+    return iroot(number, 2);
+}
+}  // namespace big_uint
@@ -0,0 +1,79 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+#include "big_uint.hpp"
+#include "limbs.hpp"
+
+namespace big_uint {
+namespace {
+// A machine word as base 10^19 limbs: words from BASE up take a second limb of one.
+struct WordLimbs {
+    std::array<Chunk, 2> limbs;
+    size_t size;
+};
+
+WordLimbs splitWord(uint64_t word) {
+    if (word >= BASE) {
+        return {.limbs = {word - BASE, 1}, .size = 2};
+    }
+    return {.limbs = {word, 0}, .size = word != 0 ? 1U : 0U};
+}
+}  // namespace
+
+BigUInt mulSmall(const BigUInt& number, uint64_t factor) noexcept {
+    std::span<const Chunk> limbs = significantLimbs(number);
+    if (limbs.empty() || factor == 0) {
+        return makeZero();
+    }
+    std::vector<Chunk> result(limbs.size() + 2);
+    // The factor may be above BASE, so the final carry can take two limbs.
+    WordLimbs carry = splitWord(mulSmallLimbs(result, limbs, factor));
+    result[limbs.size()] = carry.limbs[0];
+    result[limbs.size() + 1] = carry.limbs[1];
+    normalize(result);
+    return BigUInt{std::move(result)};
+}
+
+BigUInt addSmall(const BigUInt& number, uint64_t addend) noexcept {
+    std::span<const Chunk> limbs = significantLimbs(number);
+    WordLimbs word = splitWord(addend);
+    std::vector<Chunk> result;
+    result.reserve(std::max(limbs.size(), word.size) + 1);
+    result.assign(limbs.begin(), limbs.end());
+    result.resize(std::max(limbs.size(), word.size));
+    if (addLimbs(result, std::span<const Chunk>(word.limbs).first(word.size)) != 0) {
+        result.push_back(1);
+    }
+    return BigUInt{std::move(result)};
+}
+
+BigUInt subSmall(const BigUInt& number, uint64_t subtrahend) noexcept {
+    std::span<const Chunk> limbs = significantLimbs(number);
+    WordLimbs word = splitWord(subtrahend);
+    if (limbs.size() < word.size) {
+        return makeZero();
+    }
+    std::vector<Chunk> result(limbs.begin(), limbs.end());
+    if (subLimbs(result, std::span<const Chunk>(word.limbs).first(word.size)) != 0) {
+        return makeZero();
+    }
+    normalize(result);
+    return BigUInt{std::move(result)};
+}
+
+SmallDivMod divModSmall(const BigUInt& number, uint64_t divisor) noexcept {
+    if (divisor == 0) {
+        return {.quotient = makeZero(), .remainder = 0};
+    }
+    std::span<const Chunk> limbs = significantLimbs(number);
+    std::vector<Chunk> quotient(limbs.begin(), limbs.end());
+    // divSmallLimbs normalises the divisor and computes its reciprocal once, so every limb costs
+    // multiplications only.
+    Chunk remainder = divSmallLimbs(quotient, divisor);
+    normalize(quotient);
+    return {.quotient = BigUInt{std::move(quotient)}, .remainder = remainder};
+}
+}  // namespace big_uint
@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include "big_uint.hpp"
+#include "ntt.hpp"
+
+namespace big_uint {
+namespace {
+// Measured on an AVX-512 machine; run_tuning writes a file with the values for the host.
+constexpr Thresholds DEFAULT_THRESHOLDS = {
+    .karatsuba = 48,
+    .sqrKaratsuba = 96,
+    .toom3 = 300,
+    .toom4 = 500,
+    .ntt = 750,
+    .unbalancedNtt = 250,
+    .newtonDivision = 64,
+    .halfGcd = 160,
+    .nttPiece = MAX_NTT_SIZE / 4,
+};
+
+// The recursive kernels only shrink their operands above these sizes.
+constexpr size_t MIN_KARATSUBA = 4;
+constexpr size_t MIN_TOOM = 16;
+// The Newton reciprocal recurses on a little over half of the divisor.
+constexpr size_t MIN_NEWTON_DIVISION = 8;
+// Half-GCD recursion splits the numbers in half, and Lehmer steps on each half need two limbs.
+constexpr size_t MIN_HALF_GCD = 4;
+
+constexpr std::array<std::pair<const char*, size_t Thresholds::*>, 9> FIELDS = {{
+    {"karatsuba", &Thresholds::karatsuba},
+    {"sqr_karatsuba", &Thresholds::sqrKaratsuba},
+    {"toom3", &Thresholds::toom3},
+    {"toom4", &Thresholds::toom4},
+    {"ntt", &Thresholds::ntt},
+    {"unbalanced_ntt", &Thresholds::unbalancedNtt},
+    {"newton_division", &Thresholds::newtonDivision},
+    {"half_gcd", &Thresholds::halfGcd},
+    {"ntt_piece", &Thresholds::nttPiece},
+}};
+
+struct ThresholdStore {
+    std::array<std::atomic<size_t>, FIELDS.size()> values;
+
+    explicit ThresholdStore(const Thresholds& thresholds) {
+        store(thresholds);
+    }
+
+    void store(const Thresholds& thresholds) {
+        for (size_t index = 0; index < FIELDS.size(); ++index) {
+            values[index].store(thresholds.*FIELDS[index].second, std::memory_order_relaxed);
+        }
+    }
+};
+
+bool parseThresholds(std::istream& input, Thresholds& thresholds) {
+    std::string line;
+    while (std::getline(input, line)) {
+        line = line.substr(0, line.find('#'));
+        size_t separator = line.find('=');
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {
+            continue;
+        }
+        if (separator == std::string::npos) {
+            return false;
+        }
+        std::string key;
+        size_t value = 0;
+        std::istringstream keyStream(line.substr(0, separator));
+        std::istringstream valueStream(line.substr(separator + 1));
+        if (!(keyStream >> key) || !(valueStream >> value)) {
+            return false;
+        }
+        const auto* field = std::find_if(FIELDS.begin(), FIELDS.end(),
+                                         [&](const auto& entry) { return key == entry.first; });
+        if (field == FIELDS.end()) {
+            return false;
+        }
+        thresholds.*field->second = value;
+    }
+    return true;
+}
+
+Thresholds sanitize(Thresholds thresholds) {
+    thresholds.karatsuba = std::max(thresholds.karatsuba, MIN_KARATSUBA);
+    thresholds.sqrKaratsuba = std::max(thresholds.sqrKaratsuba, MIN_KARATSUBA);
+    thresholds.toom3 = std::max(thresholds.toom3, MIN_TOOM);
+    thresholds.toom4 = std::max(thresholds.toom4, MIN_TOOM);
+    thresholds.ntt = std::max<size_t>(thresholds.ntt, 1);
+    thresholds.unbalancedNtt = std::max<size_t>(thresholds.unbalancedNtt, 1);
+    thresholds.newtonDivision = std::max(thresholds.newtonDivision, MIN_NEWTON_DIVISION);
+    thresholds.halfGcd = std::max(thresholds.halfGcd, MIN_HALF_GCD);
+    thresholds.nttPiece = std::clamp<size_t>(thresholds.nttPiece, 1, MAX_NTT_SIZE / 4);
+    return thresholds;
+}
+
+// A file named by BIG_UINT_THRESHOLDS replaces the defaults before the first multiplication.
+Thresholds initialThresholds() {
+    const char* path = std::getenv("BIG_UINT_THRESHOLDS");
+    if (path == nullptr) {
+        return DEFAULT_THRESHOLDS;
+    }
+    std::ifstream file(path);
+    Thresholds thresholds = DEFAULT_THRESHOLDS;
+    if (!file || !parseThresholds(file, thresholds)) {
+        return DEFAULT_THRESHOLDS;
+    }
+    return sanitize(thresholds);
+}
+
+ThresholdStore& getStore() {
+    static ThresholdStore store(initialThresholds());
+    return store;
+}
+}  // namespace
+
+Thresholds getThresholds() noexcept {
+    const ThresholdStore& store = getStore();
+    Thresholds thresholds{};
+    for (size_t index = 0; index < FIELDS.size(); ++index) {
+        thresholds.*FIELDS[index].second = store.values[index].load(std::memory_order_relaxed);
+    }
+    return thresholds;
+}
+
+void setThresholds(const Thresholds& thresholds) noexcept {
+    getStore().store(sanitize(thresholds));
+}
+
+Thresholds getDefaultThresholds() noexcept {
+    return DEFAULT_THRESHOLDS;
+}
+
+bool loadThresholds(const string& path) noexcept {
+    std::ifstream file(path);
+    Thresholds thresholds = getThresholds();
+    if (!file || !parseThresholds(file, thresholds)) {
+        return false;
+    }
+    setThresholds(thresholds);
+    return true;
+}
+
+bool saveThresholds(const string& path, const Thresholds& thresholds) noexcept {
+    std::ofstream file(path);
+    file << "# Operand sizes in limbs at which mul, divMod and gcd switch algorithms.\n";
+    for (const auto& [key, field] : FIELDS) {
+        file << key << " = " << thresholds.*field << '\n';
+    }
+    return static_cast<bool>(file);
+}
+}  // namespace big_uint
@@ -1,41 +1,215 @@
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <span>
 #include <string>
+#include <system_error>
 
-#include <sys/types.h>
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
 
 #include "big_uint.hpp"
-#include "getters.hpp"
+#include "limbs.hpp"
 
 namespace big_uint {
 namespace {
-std::string addLeadingZeros(const std::string& numberStr) {
-    size_t numZeros = MAX_VALUE_LENGTH > numberStr.size() ? MAX_VALUE_LENGTH - numberStr.size() : 0;
-    return std::string(numZeros, '0') + numberStr;
+constexpr uint32_t PAIR_DIVISOR = 100;
+constexpr uint32_t EIGHT_DIGITS = 100000000;
+constexpr size_t LOW_DIGITS = 16;
+constexpr size_t TOP_DIGITS = MAX_VALUE_LENGTH - LOW_DIGITS;
+// log10(2) is about 1233 / 4096.
+constexpr size_t LOG10_2_NUMERATOR = 1233;
+constexpr unsigned LOG10_2_SHIFT = 12;
+
+// "00" to "99" back to back, so that one division by 100 writes two digits.
+constexpr std::array<char, 2 * PAIR_DIVISOR> DIGIT_PAIRS = [] {
+    std::array<char, 2 * PAIR_DIVISOR> pairs{};
+    for (size_t pair = 0; pair < PAIR_DIVISOR; ++pair) {
+        pairs[2 * pair] = static_cast<char>('0' + (pair / 10));
+        pairs[(2 * pair) + 1] = static_cast<char>('0' + (pair % 10));
+    }
+    return pairs;
+}();
+
+// Writes the count lowest digits of value, zeros included, so that the last one is at last[-1].
+// The digits are taken two at a time from the bottom.
+template <typename Unsigned>
+void writeDigits(Unsigned value, size_t count, char* last) {
+    for (; count >= 2; count -= 2) {
+        last -= 2;
+        std::memcpy(last, &DIGIT_PAIRS[2 * static_cast<size_t>(value % PAIR_DIVISOR)], 2);
+        value /= PAIR_DIVISOR;
+    }
+    if (count == 1) {
+        *(last - 1) = static_cast<char>('0' + value);
+    }
+}
+
+// A lower limb as its top TOP_DIGITS digits and two 8-digit halves of the rest, so that the digits
+// themselves come from 32-bit arithmetic rather than from 64-bit divisions.
+struct LimbBlocks {
+    uint32_t top;
+    uint32_t high;
+    uint32_t low;
+};
+
+LimbBlocks splitLimb(Chunk limb) {
+    Chunk rest = limb % POWERS_OF_TEN[LOW_DIGITS];
+    return {.top = static_cast<uint32_t>(limb / POWERS_OF_TEN[LOW_DIGITS]),
+            .high = static_cast<uint32_t>(rest / EIGHT_DIGITS),
+            .low = static_cast<uint32_t>(rest % EIGHT_DIGITS)};
+}
+
+// All MAX_VALUE_LENGTH digits of a lower limb.
+void writeLimb(Chunk limb, char* first) {
+    LimbBlocks blocks = splitLimb(limb);
+    char* last = first + MAX_VALUE_LENGTH;
+    writeDigits(blocks.low, 8, last);
+    writeDigits(blocks.high, 8, last - 8);
+    writeDigits(blocks.top, TOP_DIGITS, last - LOW_DIGITS);
+}
+
+// Writes every limb in full, the highest first, forward from first.
+void writeLimbsScalar(std::span<const Chunk> limbs, char* first) {
+    for (size_t index = limbs.size(); index-- > 0;) {
+        writeLimb(limbs[index], first);
+        first += MAX_VALUE_LENGTH;
+    }
+}
+
+#if defined(__x86_64__)
+// ceil(2^45 / 10^4), with which a multiply-shift divides any 32-bit value by 10^4 exactly.
+constexpr int64_t TEN_THOUSAND_RECIPROCAL = 3518437209;
+constexpr int TEN_THOUSAND_SHIFT = 45;
+// Divide 16-bit values below 10^4 by 100 as (x * 5243) >> 19, and those below 100 by 10 as
+// (x * 6554) >> 16.
+constexpr int16_t HUNDRED_RECIPROCAL = 5243;
+constexpr int HUNDRED_SHIFT = 3;
+constexpr int16_t TEN_RECIPROCAL = 6554;
+
+// The eight digits of the value below 10^8 in each 64-bit lane, as ASCII in the lane's bytes from
+// the first digit up. Every step splits the blocks of the step before in two with a multiply-shift:
+// into 4-digit halves in 32-bit lanes, 2-digit quarters in 16-bit lanes and then single digits,
+// one per byte.
+__attribute__((target("avx2"))) __m256i eightDigitsAvx2(__m256i values) {
+    __m256i highFours = _mm256_srli_epi64(
+        _mm256_mul_epu32(values, _mm256_set1_epi64x(TEN_THOUSAND_RECIPROCAL)), TEN_THOUSAND_SHIFT);
+    __m256i lowFours = _mm256_sub_epi64(
+        values, _mm256_mul_epu32(highFours, _mm256_set1_epi64x(POWERS_OF_TEN[4])));
+    __m256i fours = _mm256_or_si256(highFours, _mm256_slli_epi64(lowFours, 32));
+    __m256i highTwos = _mm256_srli_epi16(
+        _mm256_mulhi_epu16(fours, _mm256_set1_epi16(HUNDRED_RECIPROCAL)), HUNDRED_SHIFT);
+    __m256i lowTwos = _mm256_sub_epi16(
+        fours, _mm256_mullo_epi16(highTwos, _mm256_set1_epi16(PAIR_DIVISOR)));
+    __m256i twos = _mm256_or_si256(highTwos, _mm256_slli_epi32(lowTwos, 16));
+    __m256i tens = _mm256_mulhi_epu16(twos, _mm256_set1_epi16(TEN_RECIPROCAL));
+    __m256i units = _mm256_sub_epi16(twos, _mm256_mullo_epi16(tens, _mm256_set1_epi16(10)));
+    return _mm256_add_epi8(_mm256_or_si256(tens, _mm256_slli_epi16(units, 8)),
+                           _mm256_set1_epi8('0'));
+}
+
+// Stores 16 digits at first[offset]. The intrinsic takes a vector pointer to arbitrary chars,
+// which only a cast and pointer arithmetic can form.
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+__attribute__((target("avx2"))) void storeDigits(char* first, size_t offset, __m128i digits) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(first + offset), digits);
+}
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+// Two limbs per vector: their four 8-digit halves fill the 64-bit lanes, and each 128-bit half of
+// the result is the 16 low digits of one limb. The split of a limb into blocks needs 64-bit
+// multiply-high, which AVX2 lacks, so it stays scalar.
+__attribute__((target("avx2"))) void writeLimbsAvx2(std::span<const Chunk> limbs, char* first) {
+    size_t index = limbs.size();
+    for (; index >= 2; index -= 2) {
+        LimbBlocks upper = splitLimb(limbs[index - 1]);
+        LimbBlocks lower = splitLimb(limbs[index - 2]);
+        __m256i digits = eightDigitsAvx2(_mm256_setr_epi64x(upper.high, upper.low, lower.high,
+                                                            lower.low));
+        char* second = first + MAX_VALUE_LENGTH;
+        writeDigits(upper.top, TOP_DIGITS, first + TOP_DIGITS);
+        storeDigits(first, TOP_DIGITS, _mm256_castsi256_si128(digits));
+        writeDigits(lower.top, TOP_DIGITS, second + TOP_DIGITS);
+        storeDigits(second, TOP_DIGITS, _mm256_extracti128_si256(digits, 1));
+        first += 2 * MAX_VALUE_LENGTH;
+    }
+    if (index == 1) {
+        writeLimb(limbs[0], first);
+    }
+}
+#endif
+
+using LimbWriter = void (*)(std::span<const Chunk>, char*);
+
+LimbWriter selectLimbWriter() {
+#if defined(__x86_64__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return writeLimbsAvx2;
+    }
+#endif
+    return writeLimbsScalar;
+}
+
+LimbWriter getLimbWriter() {
+    static const LimbWriter writer = selectLimbWriter();
+    return writer;
+}
+
+// Digits of a nonzero limb. The bit length scaled by log10(2) is the count or one below it, and a
+// single comparison with a power of ten tells which.
+size_t limbDigits(Chunk limb) {
+    size_t estimate =
+        (static_cast<size_t>(std::bit_width(limb)) * LOG10_2_NUMERATOR) >> LOG10_2_SHIFT;
+    if (estimate >= MAX_VALUE_LENGTH) {
+        return MAX_VALUE_LENGTH;
+    }
+    return estimate + (limb >= POWERS_OF_TEN[estimate] ? 1 : 0);
+}
+
+// The limbs are already decimal, so the digits are the top limb without leading zeros followed by
+// every lower limb in full, written forward from first.
+void writeDecimal(std::span<const Chunk> limbs, char* first) {
+    size_t topDigits = limbDigits(limbs.back());
+    writeDigits(limbs.back(), topDigits, first + topDigits);
+    getLimbWriter()(limbs.first(limbs.size() - 1), first + topDigits);
 }
 }  // namespace
 
+size_t decimalLength(const BigUInt& number) noexcept {
+    std::span<const Chunk> limbs = significantLimbs(number);
+    if (limbs.empty()) {
+        return 1;
+    }
+    return limbDigits(limbs.back()) + (MAX_VALUE_LENGTH * (limbs.size() - 1));
+}
+
 std::string toString(const BigUInt& number) noexcept {
-    static constexpr std::string ZERO_STR = "0";
-    if (isZero(number)) {
-        return ZERO_STR;
-    }
-    std::string result;
-    result.reserve(getSize(number));
-    std::vector<Chunk> limbs = getLimbs(number);
-    uint64_t carry = 0;
-    for (size_t index = 0; index < limbs.size() - 1; index++) {
-        __uint128_t curr = limbs[index] + carry;
-        carry = static_cast<uint64_t>(curr / MAX_DEGREE_OF_TEN);
-        auto remainder = static_cast<uint64_t>(curr % MAX_DEGREE_OF_TEN);
-        std::string limbStr = addLeadingZeros(std::to_string(remainder));
-        result.insert(0, limbStr);
-    }
-    uint64_t last = number.limbs.back() + carry;
-    carry = last / MAX_DEGREE_OF_TEN;
-    result = std::to_string(last % MAX_DEGREE_OF_TEN) + result;
-    if (carry > 0) {
-        result = std::to_string(carry) + result;
+    std::span<const Chunk> limbs = significantLimbs(number);
+    std::string result(decimalLength(number), '0');
+    if (!limbs.empty()) {
+        writeDecimal(limbs, result.data());
     }
     return result;
 }
+
+std::to_chars_result toChars(const BigUInt& number, char* first, char* last) noexcept {
+    size_t length = decimalLength(number);
+    if (static_cast<size_t>(last - first) < length) {
+        return {.ptr = last, .ec = std::errc::value_too_large};
+    }
+    std::span<const Chunk> limbs = significantLimbs(number);
+    if (limbs.empty()) {
+        *first = '0';
+    } else {
+        writeDecimal(limbs, first);
+    }
+    return {.ptr = first + length, .ec = std::errc{}};
+}
 }  // namespace big_uint
@@ -418,3 +418,144 @@ TEST_F(BigUIntAddSub, ShiftCommutativeProperty) {
 
     EXPECT_FALSE(isEqual(result1, result2));
 }
+
+// In-place Tests
+TEST_F(BigUIntAddSub, AddInPlaceToZero) {
+    BigUInt lhs = createTestBigUInt({});
+    BigUInt rhs = createTestBigUInt({12345, 678});
+    BigUInt expected = createTestBigUInt({12345, 678});
+
+    addInPlace(lhs, rhs);
+
+    EXPECT_TRUE(isEqual(lhs, expected));
+}
+
+TEST_F(BigUIntAddSub, AddInPlaceCarryGrowsNumber) {
+    BigUInt lhs = createTestBigUInt({MAX_VALUE, MAX_VALUE});
+    BigUInt rhs = createTestBigUInt({1});
+    BigUInt expected = createTestBigUInt({0, 0, 1});
+
+    addInPlace(lhs, rhs);
+
+    EXPECT_TRUE(isEqual(lhs, expected));
+}
+
+TEST_F(BigUIntAddSub, AddInPlaceLongerAddend) {
+    BigUInt lhs = createTestBigUInt({MAX_VALUE});
+    BigUInt rhs = createTestBigUInt({1, 2, 3});
+    BigUInt expected = createTestBigUInt({0, 3, 3});
+
+    addInPlace(lhs, rhs);
+
+    EXPECT_TRUE(isEqual(lhs, expected));
+}
+
+TEST_F(BigUIntAddSub, AddInPlaceToItself) {
+    BigUInt number = createTestBigUInt({MAX_VALUE, 5});
+    BigUInt expected = createTestBigUInt({MAX_VALUE - 1, 11});
+
+    number += number;
+
+    EXPECT_TRUE(isEqual(number, expected));
+}
+
+TEST_F(BigUIntAddSub, AddInPlaceKeepsCapacity) {
+    BigUInt lhs = createTestBigUInt({1, 2, 3});
+    BigUInt rhs = createTestBigUInt({MAX_VALUE, MAX_VALUE});
+    const Chunk* storage = lhs.limbs.data();
+
+    lhs += rhs;
+
+    EXPECT_EQ(lhs.limbs.data(), storage);
+    EXPECT_TRUE(isEqual(lhs, createTestBigUInt({0, 2, 4})));
+}
+
+TEST_F(BigUIntAddSub, AddInPlaceMatchesAdd) {
+    BigUInt total = createTestBigUInt({});
+    BigUInt expected = createTestBigUInt({});
+    BigUInt step = createTestBigUInt({MAX_VALUE - 7, MAX_VALUE, 41});
+
+    for (size_t i = 0; i < 100; ++i) {
+        total += step;
+        expected = add(expected, step);
+    }
+
+    EXPECT_TRUE(isEqual(total, expected));
+}
+
+TEST_F(BigUIntAddSub, SubInPlaceWithBorrow) {
+    BigUInt lhs = createTestBigUInt({0, 0, 1});
+    BigUInt rhs = createTestBigUInt({1});
+    BigUInt expected = createTestBigUInt({MAX_VALUE, MAX_VALUE});
+
+    subInPlace(lhs, rhs);
+
+    EXPECT_TRUE(isEqual(lhs, expected));
+    EXPECT_EQ(lhs.limbs.size(), 2U);
+}
+
+TEST_F(BigUIntAddSub, SubInPlaceLargerGivesZero) {
+    BigUInt lhs = createTestBigUInt({5, 1});
+    BigUInt rhs = createTestBigUInt({6, 1});
+
+    lhs -= rhs;
+
+    EXPECT_TRUE(isZero(lhs));
+}
+
+TEST_F(BigUIntAddSub, SubInPlaceLongerGivesZero) {
+    BigUInt lhs = createTestBigUInt({5});
+    BigUInt rhs = createTestBigUInt({0, 1});
+
+    lhs -= rhs;
+
+    EXPECT_TRUE(isZero(lhs));
+}
+
+TEST_F(BigUIntAddSub, SubInPlaceFromItself) {
+    BigUInt number = createTestBigUInt({123, 456});
+
+    number -= number;
+
+    EXPECT_TRUE(isZero(number));
+}
+
+TEST_F(BigUIntAddSub, AddSubInPlaceInverse) {
+    BigUInt number = createTestBigUInt({MAX_VALUE, 17, MAX_VALUE});
+    BigUInt step = createTestBigUInt({3, MAX_VALUE});
+    BigUInt expected = number;
+
+    number += step;
+    number -= step;
+
+    EXPECT_TRUE(isEqual(number, expected));
+}
+
+TEST_F(BigUIntAddSub, SubWithShiftBorrowsThroughPrefix) {
+    BigUInt lhs = createTestBigUInt({1});
+    BigUInt rhs = createTestBigUInt({1});
+    BigUInt expected = createTestBigUInt({MAX_VALUE, MAX_VALUE, MAX_VALUE});
+
+    BigUInt result = sub(lhs, rhs, 3);
+
+    EXPECT_TRUE(isEqual(result, expected));
+}
+
+TEST_F(BigUIntAddSub, SubWithShiftLowerPrefixGivesZero) {
+    BigUInt lhs = createTestBigUInt({7});
+    BigUInt rhs = createTestBigUInt({1, 7});
+
+    BigUInt result = sub(lhs, rhs, 1);
+
+    EXPECT_TRUE(isZero(result));
+}
+
+TEST_F(BigUIntAddSub, AddWithShiftCarryThroughTail) {
+    BigUInt lhs = createTestBigUInt({MAX_VALUE, MAX_VALUE});
+    BigUInt rhs = createTestBigUInt({3, 1});
+    BigUInt expected = createTestBigUInt({3, 0, 0, 1});
+
+    BigUInt result = add(lhs, rhs, 1);
+
+    EXPECT_TRUE(isEqual(result, expected));
+}
@@ -0,0 +1,127 @@
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_uint.hpp"
+#include "tools.hpp"
+
+using namespace big_uint;
+
+class BigUIntDiv : public ::testing::Test {
+protected:
+    void TearDown() override {
+        setThresholds(getDefaultThresholds());
+    }
+};
+
+namespace {
+constexpr size_t NEVER = std::numeric_limits<size_t>::max();
+
+void setNewtonDivision(size_t limbs) {
+    Thresholds thresholds = getThresholds();
+    thresholds.newtonDivision = limbs;
+    setThresholds(thresholds);
+}
+
+// divisor * quotient + remainder must come back apart exactly.
+void expectDivision(const BigUInt& quotient, const BigUInt& divisor, const BigUInt& remainder) {
+    DivMod result = divMod(fma(quotient, divisor, remainder), divisor);
+
+    EXPECT_TRUE(isEqual(result.quotient, quotient));
+    EXPECT_TRUE(isEqual(result.remainder, remainder));
+}
+}  // namespace
+
+TEST_F(BigUIntDiv, ByZero) {
+    DivMod result = divMod(createTestBigUInt({123, 456}), makeZero());
+
+    EXPECT_TRUE(isZero(result.quotient));
+    EXPECT_TRUE(isZero(result.remainder));
+}
+
+TEST_F(BigUIntDiv, SmallerDividend) {
+    BigUInt dividend = createTestBigUInt({5, 7});
+    DivMod result = divMod(dividend, createTestBigUInt({5, 8}));
+
+    EXPECT_TRUE(isZero(result.quotient));
+    EXPECT_TRUE(isEqual(result.remainder, dividend));
+}
+
+TEST_F(BigUIntDiv, EqualOperands) {
+    BigUInt number = createTestBigUInt({5, 7, 9});
+    DivMod result = divMod(number, number);
+
+    EXPECT_TRUE(isEqual(result.quotient, createTestBigUInt({1})));
+    EXPECT_TRUE(isZero(result.remainder));
+}
+
+TEST_F(BigUIntDiv, SingleLimbDivisor) {
+    DivMod result = divMod(createTestBigUInt({1234567}), createTestBigUInt({1000}));
+
+    EXPECT_TRUE(isEqual(result.quotient, createTestBigUInt({1234})));
+    EXPECT_TRUE(isEqual(result.remainder, createTestBigUInt({567})));
+}
+
+TEST_F(BigUIntDiv, IgnoresLeadingZeroLimbs) {
+    DivMod result = divMod(createTestBigUInt({0, 0, 1, 0}), createTestBigUInt({0, 1, 0, 0}));
+
+    EXPECT_TRUE(isEqual(result.quotient, createTestBigUInt({0, 1})));
+    EXPECT_TRUE(isZero(result.remainder));
+}
+
+// A top divisor limb just below BASE / 2 before scaling, and quotient limbs of MAX_VALUE, take the
+// estimate corrections and the add-back step.
+TEST_F(BigUIntDiv, KnuthEdgeCases) {
+    std::vector<BigUInt> divisors = {
+        createTestBigUInt({MAX_VALUE, MAX_DEGREE_OF_TEN * 5 - 1}),
+        createTestBigUInt({0, MAX_DEGREE_OF_TEN * 5}),
+        createTestBigUInt({1, 0, 1}),
+        createTestBigUInt({MAX_VALUE, MAX_VALUE, MAX_VALUE}),
+    };
+    std::vector<BigUInt> quotients = {
+        createTestBigUInt({MAX_VALUE, MAX_VALUE}),
+        createTestBigUInt({1, MAX_VALUE - 1, 0, 3}),
+        createPatternBigUInt(9, 7919),
+    };
+    for (const BigUInt& divisor : divisors) {
+        for (const BigUInt& quotient : quotients) {
+            expectDivision(quotient, divisor, makeZero());
+            expectDivision(quotient, divisor, subSmall(divisor, 1));
+        }
+    }
+}
+
+TEST_F(BigUIntDiv, NewtonMatchesKnuth) {
+    for (auto [dividendSize, divisorSize] :
+         {std::pair<size_t, size_t>{40, 17}, {100, 20}, {301, 150}, {700, 120}, {420, 350}}) {
+        BigUInt dividend = createPatternBigUInt(dividendSize, 7919);
+        BigUInt divisor = createPatternBigUInt(divisorSize, 104729);
+        setNewtonDivision(NEVER);
+        DivMod expected = divMod(dividend, divisor);
+
+        setNewtonDivision(8);
+        DivMod result = divMod(dividend, divisor);
+
+        EXPECT_TRUE(isEqual(result.quotient, expected.quotient));
+        EXPECT_TRUE(isEqual(result.remainder, expected.remainder));
+    }
+}
+
+TEST_F(BigUIntDiv, InvertsFma) {
+    for (size_t newtonLimbs : {size_t{8}, NEVER}) {
+        setNewtonDivision(newtonLimbs);
+        for (size_t divisorSize : {2U, 3U, 25U, 90U}) {
+            BigUInt divisor = createPatternBigUInt(divisorSize, 104729);
+            for (size_t quotientSize : {1U, 12U, 200U}) {
+                BigUInt quotient = createPatternBigUInt(quotientSize, 7919);
+                expectDivision(quotient, divisor, makeZero());
+                expectDivision(quotient, divisor, subSmall(divisor, 1));
+                expectDivision(quotient, divisor, createPatternBigUInt(divisorSize - 1, 31));
+            }
+        }
+    }
+}
@@ -0,0 +1,117 @@
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_uint.hpp"
+#include "tools.hpp"
+
+using namespace big_uint;
+
+class BigUIntFma : public ::testing::Test {};
+
+namespace {
+void expectFmaMatchesMulAdd(const BigUInt& lhs, const BigUInt& rhs, const BigUInt& addend) {
+    BigUInt expected = add(mul(lhs, rhs), addend);
+    BigUInt accumulator = addend;
+
+    addMul(accumulator, lhs, rhs);
+
+    EXPECT_TRUE(isEqual(fma(lhs, rhs, addend), expected));
+    EXPECT_TRUE(isEqual(accumulator, expected));
+}
+}  // namespace
+
+TEST_F(BigUIntFma, ZeroFactor) {
+    BigUInt lhs = createTestBigUInt({});
+    BigUInt rhs = createTestBigUInt({123});
+    BigUInt addend = createTestBigUInt({456, 7});
+
+    BigUInt result = fma(lhs, rhs, addend);
+
+    EXPECT_TRUE(isEqual(result, addend));
+}
+
+TEST_F(BigUIntFma, ZeroAddend) {
+    BigUInt lhs = createTestBigUInt({3});
+    BigUInt rhs = createTestBigUInt({5});
+    BigUInt addend = createTestBigUInt({});
+    BigUInt expected = createTestBigUInt({15});
+
+    BigUInt result = fma(lhs, rhs, addend);
+
+    EXPECT_TRUE(isEqual(result, expected));
+}
+
+TEST_F(BigUIntFma, SingleLimbs) {
+    BigUInt lhs = createTestBigUInt({MAX_VALUE});
+    BigUInt rhs = createTestBigUInt({MAX_VALUE});
+    BigUInt addend = createTestBigUInt({MAX_VALUE});
+    BigUInt expected = createTestBigUInt({0, MAX_VALUE});
+
+    BigUInt result = fma(lhs, rhs, addend);
+
+    EXPECT_TRUE(isEqual(result, expected));
+}
+
+TEST_F(BigUIntFma, CarryPastProduct) {
+    BigUInt lhs = createTestBigUInt({MAX_VALUE, MAX_VALUE});
+    BigUInt rhs = createTestBigUInt({MAX_VALUE, MAX_VALUE});
+    BigUInt addend = createTestBigUInt({MAX_VALUE, MAX_VALUE, MAX_VALUE, MAX_VALUE, MAX_VALUE});
+
+    expectFmaMatchesMulAdd(lhs, rhs, addend);
+}
+
+TEST_F(BigUIntFma, MaxLimbsAllShapes) {
+    for (size_t lhsSize : {1U, 2U, 3U, 7U, 30U}) {
+        for (size_t rhsSize : {1U, 4U, 20U}) {
+            for (size_t addendSize : {0U, 1U, 5U, 60U}) {
+                BigUInt lhs = createTestBigUInt(std::vector<Chunk>(lhsSize, MAX_VALUE));
+                BigUInt rhs = createTestBigUInt(std::vector<Chunk>(rhsSize, MAX_VALUE));
+                BigUInt addend = createTestBigUInt(std::vector<Chunk>(addendSize, MAX_VALUE));
+
+                expectFmaMatchesMulAdd(lhs, rhs, addend);
+            }
+        }
+    }
+}
+
+TEST_F(BigUIntFma, LongFactors) {
+    BigUInt lhs = createPatternBigUInt(900, 7919);
+    BigUInt rhs = createPatternBigUInt(400, 104729);
+    BigUInt addend = createPatternBigUInt(1500, 31);
+
+    expectFmaMatchesMulAdd(lhs, rhs, addend);
+}
+
+TEST_F(BigUIntFma, UnbalancedFactors) {
+    BigUInt lhs = createPatternBigUInt(3000, 7919);
+    BigUInt rhs = createPatternBigUInt(3, 104729);
+    BigUInt addend = createPatternBigUInt(10, 31);
+
+    expectFmaMatchesMulAdd(lhs, rhs, addend);
+}
+
+TEST_F(BigUIntFma, AccumulatorIsFactor) {
+    BigUInt number = createPatternBigUInt(12, 7919);
+    BigUInt factor = createPatternBigUInt(5, 31);
+    BigUInt expected = add(number, mul(number, factor));
+
+    addMul(number, number, factor);
+
+    EXPECT_TRUE(isEqual(number, expected));
+}
+
+TEST_F(BigUIntFma, DotProduct) {
+    BigUInt accumulator = createTestBigUInt({});
+    BigUInt expected = createTestBigUInt({});
+
+    for (size_t i = 1; i <= 50; ++i) {
+        BigUInt lhs = createPatternBigUInt(i % 9 + 1, 7919 * i);
+        BigUInt rhs = createPatternBigUInt(i % 5 + 1, 31 * i);
+        addMul(accumulator, lhs, rhs);
+        expected = add(expected, mul(lhs, rhs));
+    }
+
+    EXPECT_TRUE(isEqual(accumulator, expected));
+}
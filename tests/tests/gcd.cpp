@@ -0,0 +1,167 @@
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_uint.hpp"
+#include "tools.hpp"
+
+using namespace big_uint;
+
+class BigUIntGcd : public ::testing::Test {
+protected:
+    void TearDown() override {
+        setThresholds(getDefaultThresholds());
+    }
+};
+
+namespace {
+constexpr size_t NEVER = std::numeric_limits<size_t>::max();
+
+void setHalfGcd(size_t limbs) {
+    Thresholds thresholds = getThresholds();
+    thresholds.halfGcd = limbs;
+    setThresholds(thresholds);
+}
+
+// Consecutive Fibonacci numbers of at least the given size, the pair with the most Euclid steps.
+std::pair<BigUInt, BigUInt> makeFibonacciPair(size_t size) {
+    BigUInt lower = createTestBigUInt({1});
+    BigUInt upper = createTestBigUInt({1});
+    while (getSize(upper) < size) {
+        lower = add(lower, upper);
+        std::swap(lower, upper);
+    }
+    return {upper, lower};
+}
+
+bool isBezoutIdentity(const BigUInt& lhs, const BigUInt& rhs, const ExtendedGcd& result) {
+    BigUInt lhsTerm = mul(lhs, result.lhsFactor);
+    BigUInt rhsTerm = mul(rhs, result.rhsFactor);
+    if (result.lhsNegative) {
+        return isGreaterOrEqual(rhsTerm, lhsTerm) && isEqual(sub(rhsTerm, lhsTerm), result.gcd);
+    }
+    return isGreaterOrEqual(lhsTerm, rhsTerm) && isEqual(sub(lhsTerm, rhsTerm), result.gcd);
+}
+
+// Sizes on both sides of the switch from Lehmer steps to half-GCD recursion.
+std::vector<size_t> makeSizes() {
+    return {1, 2, 3, 17, 90, 200, 450};
+}
+}  // namespace
+
+TEST_F(BigUIntGcd, SmallNumbers) {
+    EXPECT_TRUE(isEqual(gcd(createTestBigUInt({12}), createTestBigUInt({18})),
+                        createTestBigUInt({6})));
+    EXPECT_TRUE(isEqual(gcd(createTestBigUInt({MAX_VALUE}), createTestBigUInt({3})),
+                        createTestBigUInt({3})));
+    EXPECT_TRUE(isEqual(gcd(createTestBigUInt({0, 1}), createTestBigUInt({MAX_DEGREE_OF_TEN})),
+                        createTestBigUInt({MAX_DEGREE_OF_TEN})));
+}
+
+TEST_F(BigUIntGcd, Zero) {
+    BigUInt number = createPatternBigUInt(5, 7919);
+
+    EXPECT_TRUE(isZero(gcd(makeZero(), makeZero())));
+    EXPECT_TRUE(isEqual(gcd(number, makeZero()), number));
+    EXPECT_TRUE(isEqual(gcd(makeZero(), number), number));
+    EXPECT_TRUE(isEqual(gcd(createTestBigUInt({0, 0, 0}), number), number));
+}
+
+TEST_F(BigUIntGcd, CommonFactor) {
+    for (size_t size : makeSizes()) {
+        BigUInt factor = createPatternBigUInt(size, 104729);
+        BigUInt coprime = createPatternBigUInt(size + 3, 7919);
+        // Consecutive numbers are coprime.
+        BigUInt lhs = mul(factor, coprime);
+        BigUInt rhs = mul(factor, addSmall(coprime, 1));
+
+        EXPECT_TRUE(isEqual(gcd(lhs, rhs), factor));
+        EXPECT_TRUE(isEqual(gcd(rhs, lhs), factor));
+    }
+}
+
+TEST_F(BigUIntGcd, DivisorOfOther) {
+    BigUInt divisor = createPatternBigUInt(120, 7919);
+    BigUInt multiple = mul(divisor, createPatternBigUInt(300, 31));
+
+    EXPECT_TRUE(isEqual(gcd(multiple, divisor), divisor));
+    EXPECT_TRUE(isEqual(gcd(divisor, divisor), divisor));
+}
+
+TEST_F(BigUIntGcd, FibonacciPairs) {
+    for (size_t size : {2U, 30U, 250U}) {
+        auto [upper, lower] = makeFibonacciPair(size);
+
+        EXPECT_TRUE(isEqual(gcd(upper, lower), createTestBigUInt({1})));
+    }
+}
+
+TEST_F(BigUIntGcd, ExtendedGcdIdentity) {
+    for (size_t size : makeSizes()) {
+        BigUInt factor = createPatternBigUInt((size / 3) + 1, 31);
+        BigUInt lhs = mul(factor, createPatternBigUInt(size, 104729));
+        BigUInt rhs = mul(factor, createPatternBigUInt((size / 2) + 1, 7919));
+        for (auto [first, second] : {std::pair{lhs, rhs}, std::pair{rhs, lhs}}) {
+            ExtendedGcd result = extendedGcd(first, second);
+
+            EXPECT_TRUE(isEqual(result.gcd, gcd(first, second)));
+            EXPECT_TRUE(isBezoutIdentity(first, second, result));
+            EXPECT_TRUE(isLowerOrEqual(result.lhsFactor, second));
+            EXPECT_TRUE(isLowerOrEqual(result.rhsFactor, first));
+        }
+    }
+}
+
+TEST_F(BigUIntGcd, ResultsDoNotDependOnThreshold) {
+    BigUInt factor = createPatternBigUInt(40, 31);
+    BigUInt lhs = mul(factor, createPatternBigUInt(260, 104729));
+    BigUInt rhs = mul(factor, createPatternBigUInt(190, 7919));
+    auto [upper, lower] = makeFibonacciPair(120);
+    for (size_t limbs : {size_t{0}, size_t{16}, NEVER}) {
+        setHalfGcd(limbs);
+        ExtendedGcd result = extendedGcd(lhs, rhs);
+
+        EXPECT_TRUE(isEqual(result.gcd, factor));
+        EXPECT_TRUE(isBezoutIdentity(lhs, rhs, result));
+        EXPECT_TRUE(isEqual(gcd(upper, lower), createTestBigUInt({1})));
+    }
+}
+
+TEST_F(BigUIntGcd, ExtendedGcdWithZero) {
+    BigUInt number = createPatternBigUInt(4, 7919);
+
+    EXPECT_TRUE(isBezoutIdentity(number, makeZero(), extendedGcd(number, makeZero())));
+    EXPECT_TRUE(isBezoutIdentity(makeZero(), number, extendedGcd(makeZero(), number)));
+    EXPECT_TRUE(isZero(extendedGcd(makeZero(), makeZero()).gcd));
+}
+
+TEST_F(BigUIntGcd, ModInverse) {
+    for (size_t size : makeSizes()) {
+        BigUInt modulus = addSmall(createPatternBigUInt(size, 104729), 2);
+        ModContext context = makeModContext(modulus);
+        BigUInt number = createPatternBigUInt(size + 2, 7919);
+        BigUInt inverse = modInverse(number, modulus);
+        if (!isEqual(gcd(number, modulus), createTestBigUInt({1}))) {
+            EXPECT_TRUE(isZero(inverse));
+            continue;
+        }
+
+        EXPECT_TRUE(isLower(inverse, modulus));
+        EXPECT_TRUE(isEqual(mulMod(context, number, inverse), createTestBigUInt({1})));
+    }
+}
+
+TEST_F(BigUIntGcd, ModInverseWithoutInverse) {
+    BigUInt modulus = mulSmall(createPatternBigUInt(30, 7919), 6);
+
+    EXPECT_TRUE(isZero(modInverse(createTestBigUInt({4}), modulus)));
+    EXPECT_TRUE(isZero(modInverse(makeZero(), modulus)));
+    EXPECT_TRUE(isZero(modInverse(createTestBigUInt({3}), makeZero())));
+    EXPECT_TRUE(isZero(modInverse(createTestBigUInt({3}), createTestBigUInt({1}))));
+    EXPECT_TRUE(isEqual(modInverse(createTestBigUInt({3}), createTestBigUInt({7})),
+                        createTestBigUInt({5})));
+}
@@ -0,0 +1,115 @@
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_uint.hpp"
+#include "tools.hpp"
+
+using namespace big_uint;
+
+class BigUIntMod : public ::testing::Test {};
+
+namespace {
+BigUInt remainderOf(const BigUInt& number, const BigUInt& modulus) {
+    return divMod(number, modulus).remainder;
+}
+
+// Moduli coprime to 10, for which Montgomery applies, and even or 5-ending ones (Barrett only).
+std::vector<BigUInt> makeModuli() {
+    return {
+        createTestBigUInt({7}),
+        createTestBigUInt({10}),
+        createTestBigUInt({MAX_VALUE}),
+        createTestBigUInt({5, 1}),
+        addSmall(createPatternBigUInt(3, 7919), 2),
+        createTestBigUInt({1, 0, 0, 1}),
+        mulSmall(createPatternBigUInt(20, 104729), 2),
+        subSmall(createPatternBigUInt(70, 31), 6),
+    };
+}
+}  // namespace
+
+TEST_F(BigUIntMod, ZeroModulus) {
+    ModContext context = makeModContext(makeZero());
+    BigUInt number = createTestBigUInt({123, 456});
+
+    EXPECT_FALSE(context.hasMontgomery);
+    EXPECT_TRUE(isZero(reduce(context, number)));
+    EXPECT_TRUE(isZero(mulMod(context, number, number)));
+    EXPECT_TRUE(isZero(addMod(context, number, number)));
+}
+
+TEST_F(BigUIntMod, MontgomeryOnlyForModuliCoprimeToTen) {
+    EXPECT_TRUE(makeModContext(createTestBigUInt({7})).hasMontgomery);
+    EXPECT_TRUE(makeModContext(createTestBigUInt({MAX_VALUE, 3})).hasMontgomery);
+    EXPECT_FALSE(makeModContext(createTestBigUInt({10})).hasMontgomery);
+    EXPECT_FALSE(makeModContext(createTestBigUInt({25, 3})).hasMontgomery);
+    EXPECT_FALSE(makeModContext(createTestBigUInt({4, 3})).hasMontgomery);
+}
+
+TEST_F(BigUIntMod, ReduceMatchesDivMod) {
+    for (const BigUInt& modulus : makeModuli()) {
+        ModContext context = makeModContext(modulus);
+        for (size_t size : {0U, 1U, 2U, 5U, 41U, 150U, 333U}) {
+            BigUInt number = createPatternBigUInt(size, 7919);
+
+            EXPECT_TRUE(isEqual(reduce(context, number), remainderOf(number, modulus)));
+        }
+    }
+}
+
+TEST_F(BigUIntMod, ReduceJustBelowAndAtMultiples) {
+    BigUInt modulus = createTestBigUInt({MAX_VALUE, 5, MAX_DEGREE_OF_TEN});
+    ModContext context = makeModContext(modulus);
+    BigUInt multiple = mul(modulus, subSmall(modulus, 1));
+
+    EXPECT_TRUE(isZero(reduce(context, multiple)));
+    EXPECT_TRUE(isEqual(reduce(context, subSmall(multiple, 1)), subSmall(modulus, 1)));
+    EXPECT_TRUE(isEqual(reduce(context, modulus), makeZero()));
+}
+
+TEST_F(BigUIntMod, AddAndSubWrap) {
+    for (const BigUInt& modulus : makeModuli()) {
+        ModContext context = makeModContext(modulus);
+        BigUInt top = subSmall(modulus, 1);
+        BigUInt half = divModSmall(modulus, 2).quotient;
+
+        EXPECT_TRUE(isEqual(addMod(context, top, createTestBigUInt({1})), makeZero()));
+        EXPECT_TRUE(isEqual(addMod(context, top, top), subSmall(modulus, 2)));
+        EXPECT_TRUE(isEqual(subMod(context, makeZero(), createTestBigUInt({1})), top));
+        EXPECT_TRUE(isEqual(subMod(context, half, top), addSmall(half, 1)));
+        EXPECT_TRUE(isEqual(subMod(context, top, half), sub(top, half)));
+    }
+}
+
+TEST_F(BigUIntMod, MulAndSqrMatchDivMod) {
+    for (const BigUInt& modulus : makeModuli()) {
+        ModContext context = makeModContext(modulus);
+        BigUInt lhs = remainderOf(createPatternBigUInt(80, 7919), modulus);
+        BigUInt rhs = remainderOf(createPatternBigUInt(75, 104729), modulus);
+
+        EXPECT_TRUE(isEqual(mulMod(context, lhs, rhs), remainderOf(mul(lhs, rhs), modulus)));
+        EXPECT_TRUE(isEqual(sqrMod(context, lhs), remainderOf(sqr(lhs), modulus)));
+    }
+}
+
+TEST_F(BigUIntMod, MontgomeryMatchesBarrett) {
+    for (const BigUInt& modulus : makeModuli()) {
+        ModContext context = makeModContext(modulus);
+        if (!context.hasMontgomery) {
+            continue;
+        }
+        BigUInt lhs = remainderOf(createPatternBigUInt(80, 7919), modulus);
+        BigUInt rhs = remainderOf(createPatternBigUInt(75, 104729), modulus);
+        BigUInt lhsForm = toMontgomery(context, lhs);
+        BigUInt rhsForm = toMontgomery(context, rhs);
+
+        EXPECT_TRUE(isEqual(fromMontgomery(context, lhsForm), lhs));
+        EXPECT_TRUE(isEqual(fromMontgomery(context, montgomeryMul(context, lhsForm, rhsForm)),
+                            mulMod(context, lhs, rhs)));
+        EXPECT_TRUE(isEqual(fromMontgomery(context, montgomerySqr(context, lhsForm)),
+                            sqrMod(context, lhs)));
+    }
+}
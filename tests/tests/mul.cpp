@@ -1,4 +1,7 @@
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -9,6 +12,26 @@ using namespace big_uint;
 
 class BigUIntMul : public ::testing::Test {};
 
+namespace {
+// Limbs of (BASE^lhsSize - 1) * (BASE^rhsSize - 1) for lhsSize >= rhsSize.
+std::vector<Chunk> makeMaxLimbsProduct(size_t lhsSize, size_t rhsSize) {
+    std::vector<Chunk> limbs(lhsSize + rhsSize, MAX_VALUE);
+    limbs[0] = 1;
+    std::fill(limbs.begin() + 1, limbs.begin() + static_cast<std::ptrdiff_t>(rhsSize), 0);
+    limbs[lhsSize] = MAX_VALUE - 1;
+    return limbs;
+}
+
+// Reference product built from single-limb multiplications and shifted additions.
+BigUInt mulByLimbs(const BigUInt& lhs, const BigUInt& rhs) {
+    BigUInt result = createTestBigUInt({});
+    for (size_t i = 0; i < rhs.limbs.size(); ++i) {
+        result = add(mul(lhs, createTestBigUInt({rhs.limbs[i]})), result, i);
+    }
+    return result;
+}
+}  // namespace
+
 TEST_F(BigUIntMul, ZeroByZero) {
     BigUInt lhs = createTestBigUInt({});
     BigUInt rhs = createTestBigUInt({});
@@ -341,3 +364,215 @@ TEST_F(BigUIntMul, LargeNumberPattern) {
 
     EXPECT_FALSE(isZero(result));
 }
+
+TEST_F(BigUIntMul, KaratsubaMaxLimbsSquare) {
+    const size_t size = 300;
+    BigUInt lhs = createTestBigUInt(std::vector<Chunk>(size, MAX_VALUE));
+    BigUInt expected = createTestBigUInt(makeMaxLimbsProduct(size, size));
+
+    BigUInt result = mul(lhs, lhs);
+
+    EXPECT_TRUE(isEqual(result, expected));
+}
+
+TEST_F(BigUIntMul, KaratsubaUnbalancedMaxLimbs) {
+    const size_t lhsSize = 700;
+    const size_t rhsSize = 60;
+    BigUInt lhs = createTestBigUInt(std::vector<Chunk>(lhsSize, MAX_VALUE));
+    BigUInt rhs = createTestBigUInt(std::vector<Chunk>(rhsSize, MAX_VALUE));
+    BigUInt expected = createTestBigUInt(makeMaxLimbsProduct(lhsSize, rhsSize));
+
+    EXPECT_TRUE(isEqual(mul(lhs, rhs), expected));
+    EXPECT_TRUE(isEqual(mul(rhs, lhs), expected));
+}
+
+TEST_F(BigUIntMul, KaratsubaMatchesShiftedSum) {
+    BigUInt lhs = createPatternBigUInt(500, 7919);
+    BigUInt rhs = createPatternBigUInt(333, 104729);
+
+    BigUInt result = mul(lhs, rhs);
+
+    EXPECT_TRUE(isEqual(result, mulByLimbs(lhs, rhs)));
+}
+
+TEST_F(BigUIntMul, ToomCook3MaxLimbsSquare) {
+    const size_t size = 420;
+    BigUInt lhs = createTestBigUInt(std::vector<Chunk>(size, MAX_VALUE));
+    BigUInt expected = createTestBigUInt(makeMaxLimbsProduct(size, size));
+
+    BigUInt result = mul(lhs, lhs);
+
+    EXPECT_TRUE(isEqual(result, expected));
+}
+
+TEST_F(BigUIntMul, ToomCook4MaxLimbsSquare) {
+    const size_t size = 700;
+    BigUInt lhs = createTestBigUInt(std::vector<Chunk>(size, MAX_VALUE));
+    BigUInt expected = createTestBigUInt(makeMaxLimbsProduct(size, size));
+
+    BigUInt result = mul(lhs, lhs);
+
+    EXPECT_TRUE(isEqual(result, expected));
+}
+
+TEST_F(BigUIntMul, ToomCook3MatchesShiftedSum) {
+    BigUInt lhs = createPatternBigUInt(450, 7919);
+    BigUInt rhs = createPatternBigUInt(430, 104729);
+
+    BigUInt result = mul(lhs, rhs);
+
+    EXPECT_TRUE(isEqual(result, mulByLimbs(lhs, rhs)));
+}
+
+TEST_F(BigUIntMul, ToomCook4MatchesShiftedSum) {
+    BigUInt lhs = createPatternBigUInt(740, 7919);
+    BigUInt rhs = createPatternBigUInt(610, 104729);
+
+    BigUInt result = mul(lhs, rhs);
+
+    EXPECT_TRUE(isEqual(result, mulByLimbs(lhs, rhs)));
+}
+
+TEST_F(BigUIntMul, NttMaxLimbsSquare) {
+    const size_t size = 1600;
+    BigUInt lhs = createTestBigUInt(std::vector<Chunk>(size, MAX_VALUE));
+    BigUInt expected = createTestBigUInt(makeMaxLimbsProduct(size, size));
+
+    BigUInt result = mul(lhs, lhs);
+
+    EXPECT_TRUE(isEqual(result, expected));
+}
+
+TEST_F(BigUIntMul, NttOddPowerTransformSize) {
+    const size_t lhsSize = 3000;
+    const size_t rhsSize = 2500;
+    BigUInt lhs = createTestBigUInt(std::vector<Chunk>(lhsSize, MAX_VALUE));
+    BigUInt rhs = createTestBigUInt(std::vector<Chunk>(rhsSize, MAX_VALUE));
+    BigUInt expected = createTestBigUInt(makeMaxLimbsProduct(lhsSize, rhsSize));
+
+    BigUInt result = mul(lhs, rhs);
+
+    EXPECT_TRUE(isEqual(result, expected));
+}
+
+TEST_F(BigUIntMul, NttMatchesSplitProducts) {
+    const size_t pieceSize = 1600;
+    BigUInt lhs = createPatternBigUInt(7000, 7919);
+    BigUInt rhs = createPatternBigUInt(pieceSize, 104729);
+    BigUInt expected = createTestBigUInt({});
+    for (size_t begin = 0; begin < lhs.limbs.size(); begin += pieceSize) {
+        size_t end = std::min(begin + pieceSize, lhs.limbs.size());
+        BigUInt piece = createTestBigUInt(
+            {lhs.limbs.begin() + static_cast<std::ptrdiff_t>(begin),
+             lhs.limbs.begin() + static_cast<std::ptrdiff_t>(end)});
+        expected = add(mul(piece, rhs), expected, begin);
+    }
+
+    BigUInt result = mul(lhs, rhs);
+
+    EXPECT_TRUE(isEqual(result, expected));
+}
+
+TEST_F(BigUIntMul, UnbalancedKaratsubaBlocks) {
+    const size_t lhsSize = 5000;
+    const size_t rhsSize = 60;
+    BigUInt lhs = createTestBigUInt(std::vector<Chunk>(lhsSize, MAX_VALUE));
+    BigUInt rhs = createTestBigUInt(std::vector<Chunk>(rhsSize, MAX_VALUE));
+    BigUInt expected = createTestBigUInt(makeMaxLimbsProduct(lhsSize, rhsSize));
+
+    BigUInt result = mul(lhs, rhs);
+
+    EXPECT_TRUE(isEqual(result, expected));
+}
+
+TEST_F(BigUIntMul, UnbalancedKaratsubaBlocksPattern) {
+    BigUInt lhs = createPatternBigUInt(3000, 7919);
+    BigUInt rhs = createPatternBigUInt(200, 104729);
+
+    BigUInt result = mul(lhs, rhs);
+
+    EXPECT_TRUE(isEqual(result, mulByLimbs(lhs, rhs)));
+}
+
+TEST_F(BigUIntMul, UnbalancedNttBlocks) {
+    const size_t lhsSize = 20000;
+    const size_t rhsSize = 900;
+    BigUInt lhs = createTestBigUInt(std::vector<Chunk>(lhsSize, MAX_VALUE));
+    BigUInt rhs = createTestBigUInt(std::vector<Chunk>(rhsSize, MAX_VALUE));
+    BigUInt expected = createTestBigUInt(makeMaxLimbsProduct(lhsSize, rhsSize));
+
+    EXPECT_TRUE(isEqual(mul(lhs, rhs), expected));
+    EXPECT_TRUE(isEqual(mul(rhs, lhs), expected));
+}
+
+TEST_F(BigUIntMul, UnbalancedNttBlocksPattern) {
+    BigUInt lhs = createPatternBigUInt(9000, 7919);
+    BigUInt rhs = createPatternBigUInt(300, 104729);
+
+    BigUInt result = mul(lhs, rhs);
+
+    EXPECT_TRUE(isEqual(result, mulByLimbs(lhs, rhs)));
+}
+
+TEST_F(BigUIntMul, PreparedSmallOperand) {
+    BigUInt lhs = createPatternBigUInt(40, 7919);
+    BigUInt rhs = createPatternBigUInt(30, 104729);
+
+    PreparedMul prepared = prepare(rhs);
+
+    EXPECT_TRUE(isEqual(mul(lhs, prepared), mul(lhs, rhs)));
+}
+
+TEST_F(BigUIntMul, PreparedByZero) {
+    BigUInt zero = createTestBigUInt({});
+    BigUInt number = createPatternBigUInt(2000, 7919);
+
+    EXPECT_TRUE(isEqual(mul(zero, prepare(number)), zero));
+    EXPECT_TRUE(isEqual(mul(number, prepare(zero)), zero));
+}
+
+TEST_F(BigUIntMul, PreparedNttOperandReused) {
+    const size_t rhsSize = 1200;
+    BigUInt rhs = createTestBigUInt(std::vector<Chunk>(rhsSize, MAX_VALUE));
+    PreparedMul prepared = prepare(rhs);
+
+    for (size_t lhsSize : {1000U, 1200U, 1500U, 7000U}) {
+        BigUInt lhs = createTestBigUInt(std::vector<Chunk>(lhsSize, MAX_VALUE));
+        std::vector<Chunk> expected = lhsSize >= rhsSize ? makeMaxLimbsProduct(lhsSize, rhsSize)
+                                                         : makeMaxLimbsProduct(rhsSize, lhsSize);
+
+        BigUInt result = mul(lhs, prepared);
+
+        EXPECT_TRUE(isEqual(result, createTestBigUInt(expected)));
+    }
+}
+
+TEST_F(BigUIntMul, PreparedMatchesMul) {
+    BigUInt rhs = createPatternBigUInt(900, 104729);
+    PreparedMul prepared = prepare(rhs);
+
+    for (size_t lhsSize : {500U, 900U, 5000U}) {
+        BigUInt lhs = createPatternBigUInt(lhsSize, 7919);
+
+        EXPECT_TRUE(isEqual(mul(lhs, prepared), mul(lhs, rhs)));
+    }
+}
+
+TEST_F(BigUIntMul, ParallelNttMatchesSingleThreaded) {
+    MulParallelism previous = getMulParallelism();
+    BigUInt lhs = createPatternBigUInt(9000, 7919);
+    BigUInt rhs = createPatternBigUInt(2500, 104729);
+    BigUInt square = createPatternBigUInt(3000, 7919);
+    BigUInt expected = mul(lhs, rhs);
+    BigUInt expectedSquare = mul(square, square);
+
+    setMulParallelism({.threadCount = 4, .minLimbs = 1000});
+    BigUInt result = mul(lhs, rhs);
+    BigUInt resultSquare = sqr(square);
+    BigUInt resultPrepared = mul(lhs, prepare(rhs));
+    setMulParallelism(previous);
+
+    EXPECT_TRUE(isEqual(result, expected));
+    EXPECT_TRUE(isEqual(resultSquare, expectedSquare));
+    EXPECT_TRUE(isEqual(resultPrepared, expected));
+}
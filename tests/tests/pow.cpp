@@ -0,0 +1,114 @@
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_uint.hpp"
+#include "tools.hpp"
+
+using namespace big_uint;
+
+class BigUIntPow : public ::testing::Test {};
+
+namespace {
+// Right-to-left binary exponentiation with a division after every product, as a reference.
+BigUInt referencePowMod(const BigUInt& base, const BigUInt& exponent, const BigUInt& modulus) {
+    BigUInt result = divMod(createTestBigUInt({1}), modulus).remainder;
+    BigUInt power = divMod(base, modulus).remainder;
+    BigUInt rest = exponent;
+    while (!isZero(rest)) {
+        SmallDivMod halves = divModSmall(rest, 2);
+        if (halves.remainder != 0) {
+            result = divMod(mul(result, power), modulus).remainder;
+        }
+        power = divMod(sqr(power), modulus).remainder;
+        rest = halves.quotient;
+    }
+    return result;
+}
+}  // namespace
+
+TEST_F(BigUIntPow, PowZeroExponentAndBase) {
+    EXPECT_TRUE(isEqual(pow(makeZero(), 0), createTestBigUInt({1})));
+    EXPECT_TRUE(isEqual(pow(createTestBigUInt({5, 7}), 0), createTestBigUInt({1})));
+    EXPECT_TRUE(isZero(pow(makeZero(), 5)));
+}
+
+TEST_F(BigUIntPow, PowOfTenIsShift) {
+    EXPECT_TRUE(isEqual(pow(createTestBigUInt({10}), 19), createTestBigUInt({0, 1})));
+    EXPECT_TRUE(isEqual(pow(createTestBigUInt({100000}), 7),
+                        createTestBigUInt({0, 10000000000000000ULL})));
+    EXPECT_TRUE(isEqual(pow(createTestBigUInt({1}), 1000), createTestBigUInt({1})));
+    EXPECT_TRUE(isEqual(pow(createTestBigUInt({0, 10}), 2), createTestBigUInt({0, 0, 100})));
+}
+
+TEST_F(BigUIntPow, PowWithZeroLimbsShifts) {
+    BigUInt base = createTestBigUInt({0, 0, 7, 3});
+    BigUInt factor = createTestBigUInt({7, 3});
+
+    EXPECT_TRUE(isEqual(pow(base, 3), add(mul(sqr(factor), factor), makeZero(), 6)));
+}
+
+TEST_F(BigUIntPow, PowMatchesRepeatedMul) {
+    for (const BigUInt& base : {createTestBigUInt({3}), createTestBigUInt({MAX_VALUE}),
+                                createPatternBigUInt(3, 7919)}) {
+        BigUInt expected = createTestBigUInt({1});
+        for (uint64_t exponent = 1; exponent <= 70; ++exponent) {
+            expected = mul(expected, base);
+
+            EXPECT_TRUE(isEqual(pow(base, exponent), expected));
+        }
+    }
+}
+
+TEST_F(BigUIntPow, PowModSmallValues) {
+    BigUInt result =
+        powMod(createTestBigUInt({4}), createTestBigUInt({13}), createTestBigUInt({497}));
+
+    EXPECT_TRUE(isEqual(result, createTestBigUInt({445})));
+}
+
+TEST_F(BigUIntPow, PowModEdgeCases) {
+    BigUInt base = createTestBigUInt({123, 456});
+    BigUInt modulus = createTestBigUInt({789, 1});
+
+    EXPECT_TRUE(isEqual(powMod(base, makeZero(), modulus), createTestBigUInt({1})));
+    EXPECT_TRUE(isZero(powMod(base, makeZero(), createTestBigUInt({1}))));
+    EXPECT_TRUE(isZero(powMod(base, createTestBigUInt({5}), makeZero())));
+    EXPECT_TRUE(isZero(powMod(makeZero(), createTestBigUInt({5}), modulus)));
+    EXPECT_TRUE(isEqual(powMod(base, createTestBigUInt({1}), modulus),
+                        divMod(base, modulus).remainder));
+}
+
+// Fermat: a^(p-1) = 1 mod p for the prime 2^61 - 1, which takes the Montgomery path.
+TEST_F(BigUIntPow, PowModFermat) {
+    BigUInt prime = createTestBigUInt({2305843009213693951ULL});
+    BigUInt exponent = subSmall(prime, 1);
+
+    for (Chunk base : {2ULL, 3ULL, 1234567890123ULL}) {
+        EXPECT_TRUE(isEqual(powMod(createTestBigUInt({base}), exponent, prime),
+                            createTestBigUInt({1})));
+    }
+}
+
+TEST_F(BigUIntPow, PowModMatchesReference) {
+    std::vector<BigUInt> moduli = {
+        createTestBigUInt({MAX_VALUE - 2}),
+        mulSmall(createPatternBigUInt(3, 7919), 2),
+        addSmall(createPatternBigUInt(6, 31), 4),
+        mulSmall(createPatternBigUInt(12, 104729), 5),
+    };
+    BigUInt base = createPatternBigUInt(14, 7919);
+    for (const BigUInt& modulus : moduli) {
+        for (size_t exponentSize : {1U, 2U, 6U}) {
+            BigUInt exponent = createPatternBigUInt(exponentSize, 104729);
+            ModContext context = makeModContext(modulus);
+
+            BigUInt expected = referencePowMod(base, exponent, modulus);
+
+            EXPECT_TRUE(isEqual(powMod(base, exponent, modulus), expected));
+            EXPECT_TRUE(isEqual(powMod(context, base, exponent), expected));
+        }
+    }
+}
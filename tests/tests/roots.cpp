@@ -0,0 +1,75 @@
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_uint.hpp"
+#include "tools.hpp"
+
+using namespace big_uint;
+
+class BigUIntRoots : public ::testing::Test {};
+
+namespace {
+// root is floor(number^(1/degree)) exactly when root^degree <= number < (root + 1)^degree.
+void expectRoot(const BigUInt& number, uint64_t degree, const BigUInt& root) {
+    EXPECT_TRUE(isLowerOrEqual(pow(root, degree), number));
+    EXPECT_TRUE(isGreater(pow(addSmall(root, 1), degree), number));
+}
+}  // namespace
+
+TEST_F(BigUIntRoots, SmallValues) {
+    EXPECT_TRUE(isZero(isqrt(makeZero())));
+    EXPECT_TRUE(isEqual(isqrt(createTestBigUInt({1})), createTestBigUInt({1})));
+    EXPECT_TRUE(isEqual(isqrt(createTestBigUInt({15})), createTestBigUInt({3})));
+    EXPECT_TRUE(isEqual(isqrt(createTestBigUInt({16})), createTestBigUInt({4})));
+    EXPECT_TRUE(isEqual(iroot(createTestBigUInt({1000}), 3), createTestBigUInt({10})));
+    EXPECT_TRUE(isEqual(iroot(createTestBigUInt({999}), 3), createTestBigUInt({9})));
+}
+
+TEST_F(BigUIntRoots, DegreeZeroAndOne) {
+    BigUInt number = createTestBigUInt({5, 7, 0});
+
+    EXPECT_TRUE(isZero(iroot(number, 0)));
+    EXPECT_TRUE(isEqual(iroot(number, 1), createTestBigUInt({5, 7})));
+}
+
+TEST_F(BigUIntRoots, DegreeAtLeastBitLength) {
+    BigUInt one = createTestBigUInt({1});
+    BigUInt powerOfTwo = pow(createTestBigUInt({2}), 200);
+
+    EXPECT_TRUE(isEqual(iroot(createTestBigUInt({100}), uint64_t{1} << 40U), one));
+    EXPECT_TRUE(isEqual(iroot(createPatternBigUInt(50, 7919), uint64_t{1} << 40U), one));
+    EXPECT_TRUE(isEqual(iroot(createTestBigUInt({100}), 7), one));
+    EXPECT_TRUE(isEqual(iroot(createTestBigUInt({100}), 6), createTestBigUInt({2})));
+    EXPECT_TRUE(isEqual(iroot(powerOfTwo, 200), createTestBigUInt({2})));
+    EXPECT_TRUE(isEqual(iroot(powerOfTwo, 201), one));
+    EXPECT_TRUE(isEqual(iroot(subSmall(powerOfTwo, 1), 200), one));
+}
+
+TEST_F(BigUIntRoots, PerfectPowers) {
+    for (size_t size : {1U, 2U, 7U, 40U, 300U}) {
+        BigUInt root = createPatternBigUInt(size, 7919);
+        for (uint64_t degree : {2U, 3U, 5U}) {
+            BigUInt power = pow(root, degree);
+
+            EXPECT_TRUE(isEqual(iroot(power, degree), root));
+            EXPECT_TRUE(isEqual(iroot(subSmall(power, 1), degree), subSmall(root, 1)));
+        }
+    }
+}
+
+TEST_F(BigUIntRoots, SquareRootOfPowerOfBase) {
+    EXPECT_TRUE(isEqual(isqrt(createTestBigUInt({0, 0, 0, 0, 1})), createTestBigUInt({0, 0, 1})));
+    expectRoot(createTestBigUInt({0, 0, 0, 1}), 2, isqrt(createTestBigUInt({0, 0, 0, 1})));
+}
+
+TEST_F(BigUIntRoots, RootsOfPatterns) {
+    for (size_t size : {1U, 2U, 3U, 9U, 64U, 501U}) {
+        BigUInt number = createPatternBigUInt(size, 104729);
+        for (uint64_t degree : {2U, 3U, 4U, 7U, 19U, 1000U}) {
+            expectRoot(number, degree, iroot(number, degree));
+        }
+    }
+}
@@ -0,0 +1,134 @@
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_uint.hpp"
+#include "tools.hpp"
+
+using namespace big_uint;
+
+class BigUIntSmall : public ::testing::Test {};
+
+namespace {
+constexpr uint64_t MAX_WORD = std::numeric_limits<uint64_t>::max();
+
+BigUInt makeWord(uint64_t word) {
+    if (word > MAX_VALUE) {
+        return createTestBigUInt({word - MAX_VALUE - 1, 1});
+    }
+    return createTestBigUInt(word != 0 ? std::vector<Chunk>{word} : std::vector<Chunk>{});
+}
+
+const std::vector<uint64_t> WORDS = {0, 1, 7, 10, MAX_DEGREE_OF_TEN, MAX_VALUE, MAX_VALUE + 1,
+                                     MAX_WORD};
+}  // namespace
+
+TEST_F(BigUIntSmall, MulSmallByZero) {
+    BigUInt number = createTestBigUInt({123, 456});
+
+    BigUInt result = mulSmall(number, 0);
+
+    EXPECT_TRUE(isZero(result));
+}
+
+TEST_F(BigUIntSmall, MulSmallCarry) {
+    BigUInt number = createTestBigUInt({MAX_VALUE});
+    BigUInt expected = createTestBigUInt({MAX_VALUE - 9, 9});
+
+    BigUInt result = mulSmall(number, 10);
+
+    EXPECT_TRUE(isEqual(result, expected));
+}
+
+TEST_F(BigUIntSmall, MulSmallMatchesMul) {
+    for (size_t size : {0U, 1U, 2U, 30U}) {
+        BigUInt number = createPatternBigUInt(size, 7919);
+        for (uint64_t word : WORDS) {
+            EXPECT_TRUE(isEqual(mulSmall(number, word), mul(number, makeWord(word))));
+        }
+    }
+}
+
+TEST_F(BigUIntSmall, AddSmallCarry) {
+    BigUInt number = createTestBigUInt({MAX_VALUE, MAX_VALUE});
+    BigUInt expected = createTestBigUInt({0, 0, 1});
+
+    BigUInt result = addSmall(number, 1);
+
+    EXPECT_TRUE(isEqual(result, expected));
+}
+
+TEST_F(BigUIntSmall, AddSmallMatchesAdd) {
+    for (size_t size : {0U, 1U, 2U, 30U}) {
+        BigUInt number = createPatternBigUInt(size, 7919);
+        for (uint64_t word : WORDS) {
+            EXPECT_TRUE(isEqual(addSmall(number, word), add(number, makeWord(word))));
+        }
+    }
+}
+
+TEST_F(BigUIntSmall, SubSmallBorrow) {
+    BigUInt number = createTestBigUInt({0, 0, 1});
+    BigUInt expected = createTestBigUInt({MAX_VALUE, MAX_VALUE});
+
+    BigUInt result = subSmall(number, 1);
+
+    EXPECT_TRUE(isEqual(result, expected));
+}
+
+TEST_F(BigUIntSmall, SubSmallLargerGivesZero) {
+    BigUInt number = createTestBigUInt({5});
+
+    EXPECT_TRUE(isZero(subSmall(number, 6)));
+    EXPECT_TRUE(isZero(subSmall(number, MAX_WORD)));
+    EXPECT_TRUE(isZero(subSmall(createTestBigUInt({}), 1)));
+}
+
+TEST_F(BigUIntSmall, SubSmallMatchesSub) {
+    for (size_t size : {1U, 2U, 30U}) {
+        BigUInt number = createPatternBigUInt(size, 7919);
+        for (uint64_t word : WORDS) {
+            EXPECT_TRUE(isEqual(subSmall(number, word), sub(number, makeWord(word))));
+        }
+    }
+}
+
+TEST_F(BigUIntSmall, DivModSmallByZero) {
+    SmallDivMod result = divModSmall(createTestBigUInt({123}), 0);
+
+    EXPECT_TRUE(isZero(result.quotient));
+    EXPECT_EQ(result.remainder, 0U);
+}
+
+TEST_F(BigUIntSmall, DivModSmallSingleLimb) {
+    SmallDivMod result = divModSmall(createTestBigUInt({1234567}), 1000);
+
+    EXPECT_TRUE(isEqual(result.quotient, createTestBigUInt({1234})));
+    EXPECT_EQ(result.remainder, 567U);
+}
+
+TEST_F(BigUIntSmall, DivModSmallAcrossLimbs) {
+    SmallDivMod result = divModSmall(createTestBigUInt({0, 1}), 10);
+
+    EXPECT_TRUE(isEqual(result.quotient, createTestBigUInt({MAX_DEGREE_OF_TEN})));
+    EXPECT_EQ(result.remainder, 0U);
+}
+
+TEST_F(BigUIntSmall, DivModSmallInvertsMulSmall) {
+    for (size_t size : {0U, 1U, 2U, 30U}) {
+        BigUInt number = createPatternBigUInt(size, 7919);
+        for (uint64_t word : WORDS) {
+            if (word == 0) {
+                continue;
+            }
+            uint64_t remainder = (word - 1) / 3;
+            SmallDivMod result = divModSmall(addSmall(mulSmall(number, word), remainder), word);
+
+            EXPECT_TRUE(isEqual(result.quotient, number));
+            EXPECT_EQ(result.remainder, remainder);
+        }
+    }
+}
@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_uint.hpp"
+#include "tools.hpp"
+
+using namespace big_uint;
+
+class BigUIntSqr : public ::testing::Test {};
+
+namespace {
+// The copy has its own limbs, so mul() takes the general product path.
+void expectSquareMatchesProduct(const BigUInt& number) {
+    BigUInt copy = number;
+
+    EXPECT_TRUE(isEqual(sqr(number), mul(number, copy)));
+    EXPECT_TRUE(isEqual(mul(number, number), mul(number, copy)));
+}
+}  // namespace
+
+TEST_F(BigUIntSqr, Zero) {
+    BigUInt number = createTestBigUInt({});
+    BigUInt expected = createTestBigUInt({});
+
+    BigUInt result = sqr(number);
+
+    EXPECT_TRUE(isEqual(result, expected));
+}
+
+TEST_F(BigUIntSqr, SingleChunk) {
+    BigUInt number = createTestBigUInt({12345});
+    BigUInt expected = createTestBigUInt({152399025});
+
+    BigUInt result = sqr(number);
+
+    EXPECT_TRUE(isEqual(result, expected));
+}
+
+TEST_F(BigUIntSqr, MaxChunk) {
+    BigUInt number = createTestBigUInt({MAX_VALUE});
+    BigUInt expected = createTestBigUInt({1, MAX_VALUE - 1});
+
+    BigUInt result = sqr(number);
+
+    EXPECT_TRUE(isEqual(result, expected));
+}
+
+TEST_F(BigUIntSqr, MaxLimbs) {
+    const size_t size = 40;
+    BigUInt number = createTestBigUInt(std::vector<Chunk>(size, MAX_VALUE));
+    std::vector<Chunk> limbs(2 * size, MAX_VALUE);
+    limbs[0] = 1;
+    std::fill(limbs.begin() + 1, limbs.begin() + static_cast<std::ptrdiff_t>(size), 0);
+    limbs[size] = MAX_VALUE - 1;
+    BigUInt expected = createTestBigUInt(limbs);
+
+    BigUInt result = sqr(number);
+
+    EXPECT_TRUE(isEqual(result, expected));
+}
+
+TEST_F(BigUIntSqr, SchoolbookSizes) {
+    for (size_t size : {2U, 3U, 17U, 95U}) {
+        expectSquareMatchesProduct(createPatternBigUInt(size, 7919));
+    }
+}
+
+TEST_F(BigUIntSqr, KaratsubaSizes) {
+    for (size_t size : {96U, 97U, 250U}) {
+        expectSquareMatchesProduct(createPatternBigUInt(size, 104729));
+    }
+}
+
+TEST_F(BigUIntSqr, ToomCookSizes) {
+    for (size_t size : {350U, 701U}) {
+        expectSquareMatchesProduct(createPatternBigUInt(size, 7919));
+    }
+}
+
+TEST_F(BigUIntSqr, NttSizes) {
+    for (size_t size : {1024U, 3000U}) {
+        expectSquareMatchesProduct(createPatternBigUInt(size, 104729));
+    }
+}
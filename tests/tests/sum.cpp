@@ -0,0 +1,89 @@
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_uint.hpp"
+#include "tools.hpp"
+
+using namespace big_uint;
+
+class BigUIntSum : public ::testing::Test {};
+
+namespace {
+BigUInt sumByAdd(const std::vector<BigUInt>& numbers) {
+    BigUInt total = createTestBigUInt({});
+    for (const BigUInt& number : numbers) {
+        total = add(total, number);
+    }
+    return total;
+}
+}  // namespace
+
+TEST_F(BigUIntSum, Empty) {
+    std::vector<BigUInt> numbers;
+
+    BigUInt result = sum(numbers);
+
+    EXPECT_TRUE(isZero(result));
+}
+
+TEST_F(BigUIntSum, Zeros) {
+    std::vector<BigUInt> numbers = {createTestBigUInt({}), createTestBigUInt({0, 0})};
+
+    BigUInt result = sum(numbers);
+
+    EXPECT_TRUE(isZero(result));
+}
+
+TEST_F(BigUIntSum, SingleNumber) {
+    std::vector<BigUInt> numbers = {createTestBigUInt({123, 456})};
+    BigUInt expected = createTestBigUInt({123, 456});
+
+    BigUInt result = sum(numbers);
+
+    EXPECT_TRUE(isEqual(result, expected));
+}
+
+TEST_F(BigUIntSum, CarryGrowsNumber) {
+    std::vector<BigUInt> numbers = {createTestBigUInt({MAX_VALUE, MAX_VALUE}),
+                                    createTestBigUInt({1})};
+    BigUInt expected = createTestBigUInt({0, 0, 1});
+
+    BigUInt result = sum(numbers);
+
+    EXPECT_TRUE(isEqual(result, expected));
+}
+
+TEST_F(BigUIntSum, DifferentSizes) {
+    std::vector<BigUInt> numbers = {createTestBigUInt({5}), createTestBigUInt({MAX_VALUE, 7, 9}),
+                                    createTestBigUInt({MAX_VALUE, MAX_VALUE})};
+    BigUInt expected = createTestBigUInt({3, 8, 10});
+
+    BigUInt result = sum(numbers);
+
+    EXPECT_TRUE(isEqual(result, expected));
+}
+
+TEST_F(BigUIntSum, ManyMaxNumbers) {
+    std::vector<BigUInt> numbers(1000, createTestBigUInt({MAX_VALUE, MAX_VALUE, MAX_VALUE}));
+
+    BigUInt result = sum(numbers);
+
+    EXPECT_TRUE(isEqual(result, sumByAdd(numbers)));
+}
+
+TEST_F(BigUIntSum, LongNumbersAcrossBlocks) {
+    std::vector<BigUInt> numbers;
+    for (size_t count = 0; count < 20; ++count) {
+        std::vector<Chunk> limbs(2500 + (count * 37));
+        for (size_t i = 0; i < limbs.size(); ++i) {
+            limbs[i] = (count % 3 == 0) ? MAX_VALUE : MAX_VALUE - ((i * 7919 + count) % 1000003);
+        }
+        numbers.push_back(createTestBigUInt(limbs));
+    }
+
+    BigUInt result = sum(numbers);
+
+    EXPECT_TRUE(isEqual(result, sumByAdd(numbers)));
+}
@@ -0,0 +1,193 @@
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "big_uint.hpp"
+#include "tools.hpp"
+
+using namespace big_uint;
+
+class BigUIntThresholds : public ::testing::Test {
+protected:
+    void TearDown() override {
+        setThresholds(getDefaultThresholds());
+    }
+};
+
+namespace {
+constexpr size_t NEVER = std::numeric_limits<size_t>::max();
+
+bool isSameThresholds(const Thresholds& left, const Thresholds& right) {
+    return left.karatsuba == right.karatsuba && left.sqrKaratsuba == right.sqrKaratsuba &&
+           left.toom3 == right.toom3 && left.toom4 == right.toom4 && left.ntt == right.ntt &&
+           left.unbalancedNtt == right.unbalancedNtt &&
+           left.newtonDivision == right.newtonDivision && left.halfGcd == right.halfGcd &&
+           left.nttPiece == right.nttPiece;
+}
+
+std::filesystem::path makeTempPath(const char* name) {
+    return std::filesystem::temp_directory_path() / name;
+}
+}  // namespace
+
+TEST_F(BigUIntThresholds, SetAndGet) {
+    Thresholds thresholds{.karatsuba = 40,
+                          .sqrKaratsuba = 80,
+                          .toom3 = 200,
+                          .toom4 = 400,
+                          .ntt = 1000,
+                          .unbalancedNtt = 300,
+                          .newtonDivision = 150,
+                          .halfGcd = 250,
+                          .nttPiece = 4096};
+
+    setThresholds(thresholds);
+
+    EXPECT_TRUE(isSameThresholds(getThresholds(), thresholds));
+}
+
+TEST_F(BigUIntThresholds, TooSmallValuesAreRaised) {
+    setThresholds({.karatsuba = 0,
+                   .sqrKaratsuba = 1,
+                   .toom3 = 2,
+                   .toom4 = 3,
+                   .ntt = 0,
+                   .unbalancedNtt = 0,
+                   .newtonDivision = 0,
+                   .halfGcd = 0,
+                   .nttPiece = 0});
+
+    Thresholds thresholds = getThresholds();
+
+    EXPECT_GE(thresholds.karatsuba, 2U);
+    EXPECT_GE(thresholds.sqrKaratsuba, 2U);
+    EXPECT_GE(thresholds.toom3, thresholds.karatsuba);
+    EXPECT_GE(thresholds.toom4, thresholds.karatsuba);
+    EXPECT_GE(thresholds.ntt, 1U);
+    EXPECT_GE(thresholds.unbalancedNtt, 1U);
+    EXPECT_GE(thresholds.newtonDivision, 2U);
+    EXPECT_GE(thresholds.halfGcd, 2U);
+    EXPECT_GE(thresholds.nttPiece, 1U);
+}
+
+TEST_F(BigUIntThresholds, NttPieceIsCapped) {
+    Thresholds thresholds = getDefaultThresholds();
+    thresholds.nttPiece = NEVER;
+
+    setThresholds(thresholds);
+
+    EXPECT_EQ(getThresholds().nttPiece, getDefaultThresholds().nttPiece);
+}
+
+TEST_F(BigUIntThresholds, SaveAndLoad) {
+    std::filesystem::path path = makeTempPath("big_uint_thresholds_roundtrip.conf");
+    Thresholds thresholds{.karatsuba = 32,
+                          .sqrKaratsuba = 64,
+                          .toom3 = 256,
+                          .toom4 = 512,
+                          .ntt = 2048,
+                          .unbalancedNtt = 128,
+                          .newtonDivision = 64,
+                          .halfGcd = 96,
+                          .nttPiece = 1024};
+
+    ASSERT_TRUE(saveThresholds(path.string(), thresholds));
+    setThresholds(getDefaultThresholds());
+    bool loaded = loadThresholds(path.string());
+    std::filesystem::remove(path);
+
+    EXPECT_TRUE(loaded);
+    EXPECT_TRUE(isSameThresholds(getThresholds(), thresholds));
+}
+
+TEST_F(BigUIntThresholds, LoadKeepsMissingValues) {
+    std::filesystem::path path = makeTempPath("big_uint_thresholds_partial.conf");
+    std::ofstream(path) << "# only one value\n  toom3 = 333  \n\n";
+    Thresholds expected = getDefaultThresholds();
+    expected.toom3 = 333;
+
+    bool loaded = loadThresholds(path.string());
+    std::filesystem::remove(path);
+
+    EXPECT_TRUE(loaded);
+    EXPECT_TRUE(isSameThresholds(getThresholds(), expected));
+}
+
+TEST_F(BigUIntThresholds, MalformedFileIsRejected) {
+    std::filesystem::path path = makeTempPath("big_uint_thresholds_malformed.conf");
+    std::ofstream(path) << "karatsuba = 20\nfast_fourier = 7\n";
+
+    bool loaded = loadThresholds(path.string());
+    std::filesystem::remove(path);
+
+    EXPECT_FALSE(loaded);
+    EXPECT_TRUE(isSameThresholds(getThresholds(), getDefaultThresholds()));
+}
+
+TEST_F(BigUIntThresholds, MissingFileIsRejected) {
+    EXPECT_FALSE(loadThresholds(makeTempPath("big_uint_thresholds_missing.conf").string()));
+}
+
+TEST_F(BigUIntThresholds, ProductsDoNotDependOnThresholds) {
+    BigUInt lhs = createPatternBigUInt(700, 7919);
+    BigUInt rhs = createPatternBigUInt(300, 104729);
+    BigUInt expectedProduct = mul(lhs, rhs);
+    BigUInt expectedSquare = sqr(lhs);
+
+    setThresholds({.karatsuba = 0,
+                   .sqrKaratsuba = 0,
+                   .toom3 = 0,
+                   .toom4 = 0,
+                   .ntt = NEVER,
+                   .unbalancedNtt = NEVER,
+                   .newtonDivision = NEVER,
+                   .halfGcd = NEVER,
+                   .nttPiece = NEVER});
+    BigUInt recursiveProduct = mul(lhs, rhs);
+    BigUInt recursiveSquare = sqr(lhs);
+    setThresholds({.karatsuba = NEVER,
+                   .sqrKaratsuba = NEVER,
+                   .toom3 = NEVER,
+                   .toom4 = NEVER,
+                   .ntt = 1,
+                   .unbalancedNtt = 1,
+                   .newtonDivision = NEVER,
+                   .halfGcd = NEVER,
+                   .nttPiece = NEVER});
+    BigUInt nttProduct = mul(lhs, rhs);
+    BigUInt nttSquare = sqr(lhs);
+
+    EXPECT_TRUE(isEqual(recursiveProduct, expectedProduct));
+    EXPECT_TRUE(isEqual(recursiveSquare, expectedSquare));
+    EXPECT_TRUE(isEqual(nttProduct, expectedProduct));
+    EXPECT_TRUE(isEqual(nttSquare, expectedSquare));
+}
+
+TEST_F(BigUIntThresholds, NttPiecesMatchWholeTransform) {
+    BigUInt lhs = createPatternBigUInt(700, 7919);
+    BigUInt rhs = createPatternBigUInt(300, 104729);
+    // A shorter factor with a run of zero limbs longer than a piece.
+    std::vector<Chunk> sparseLimbs(300, 0);
+    sparseLimbs.front() = 1;
+    sparseLimbs.back() = 7919;
+    BigUInt sparse = createTestBigUInt(sparseLimbs);
+    BigUInt expectedProduct = mul(lhs, rhs);
+    BigUInt expectedSparse = mul(lhs, sparse);
+    BigUInt expectedSquare = sqr(rhs);
+
+    Thresholds thresholds = getDefaultThresholds();
+    thresholds.ntt = 1;
+    thresholds.unbalancedNtt = 1;
+    thresholds.nttPiece = 64;
+    setThresholds(thresholds);
+
+    EXPECT_TRUE(isEqual(mul(lhs, rhs), expectedProduct));
+    EXPECT_TRUE(isEqual(mul(rhs, lhs), expectedProduct));
+    EXPECT_TRUE(isEqual(mul(lhs, sparse), expectedSparse));
+    EXPECT_TRUE(isEqual(sqr(rhs), expectedSquare));
+}
@@ -1,4 +1,7 @@
+#include <cstdint>
 #include <string>
+#include <system_error>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -13,6 +16,25 @@ namespace {
 string makeZerosString(size_t count) {
     return string(count, '0');  // NOLINT
 }
+
+// Values around every power of ten and every power of two that fit in a limb, where the digit
+// count of a top limb changes or its bit length does.
+std::vector<Chunk> makeBoundaryLimbs() {
+    std::vector<Chunk> limbs = {MAX_VALUE};
+    for (Chunk power = 1; power <= MAX_DEGREE_OF_TEN; power *= 10) {
+        limbs.push_back(power);
+        limbs.push_back(power + 1);
+        limbs.push_back(power > 1 ? power - 1 : power);
+    }
+    for (unsigned bit = 0; bit < 64; ++bit) {
+        Chunk power = Chunk{1} << bit;
+        if (power <= MAX_VALUE) {
+            limbs.push_back(power);
+            limbs.push_back(power > 1 ? power - 1 : power);
+        }
+    }
+    return limbs;
+}
 }  // namespace
 
 TEST(BigUIntToString, EmptyNumber) {
@@ -73,3 +95,102 @@ TEST(BigUIntToString, MostSignificantNotPadded) {
 
     EXPECT_EQ(result, expected);
 }
+
+TEST(BigUIntToString, LowerLimbsFromTenToTheEighteen) {
+    BigUInt num = createTestBigUInt({MAX_DEGREE_OF_TEN, MAX_VALUE, 5});
+    string expected = to_string(5) + to_string(MAX_VALUE) + to_string(MAX_DEGREE_OF_TEN);
+
+    string result = toString(num);
+
+    EXPECT_EQ(result, expected);
+}
+
+TEST(BigUIntToString, TopLimbPowersOfTen) {
+    for (Chunk power = 1; power <= MAX_DEGREE_OF_TEN; power *= 10) {
+        BigUInt num = createTestBigUInt({0, power});
+        string expected = to_string(power) + makeZerosString(MAX_VALUE_LENGTH);
+
+        string result = toString(num);
+
+        EXPECT_EQ(result, expected);
+    }
+}
+
+TEST(BigUIntToString, LeadingZeroLimbsIgnored) {
+    BigUInt num = createTestBigUInt({7, 0, 0});
+    string expected = "7";
+
+    string result = toString(num);
+
+    EXPECT_EQ(result, expected);
+}
+
+TEST(BigUIntToString, ZeroLimbsOnly) {
+    BigUInt num = createTestBigUInt({0, 0});
+    string expected = "0";
+
+    string result = toString(num);
+
+    EXPECT_EQ(result, expected);
+}
+
+TEST(BigUIntDecimalLength, Zero) {
+    EXPECT_EQ(decimalLength(createTestBigUInt({})), 1);
+    EXPECT_EQ(decimalLength(createTestBigUInt({0, 0})), 1);
+}
+
+TEST(BigUIntDecimalLength, MatchesToString) {
+    for (Chunk top : makeBoundaryLimbs()) {
+        for (size_t lowerLimbs : {0U, 1U, 3U}) {
+            std::vector<Chunk> limbs(lowerLimbs, MAX_DEGREE_OF_TEN);
+            limbs.push_back(top);
+            BigUInt num = createTestBigUInt(limbs);
+
+            EXPECT_EQ(decimalLength(num), toString(num).size());
+        }
+    }
+}
+
+TEST(BigUIntToChars, MatchesToString) {
+    BigUInt num = createTestBigUInt({123, MAX_VALUE, 0, MAX_DEGREE_OF_TEN, 4567});
+    string expected = toString(num);
+    string buffer(expected.size() + 5, '#');
+
+    std::to_chars_result result = toChars(num, buffer.data(), buffer.data() + buffer.size());
+
+    EXPECT_EQ(result.ec, std::errc{});
+    EXPECT_EQ(result.ptr, buffer.data() + expected.size());
+    EXPECT_EQ(buffer, expected + "#####");
+}
+
+TEST(BigUIntToChars, ExactBuffer) {
+    BigUInt num = createTestBigUInt({42, 1});
+    string buffer(decimalLength(num), '#');
+
+    std::to_chars_result result = toChars(num, buffer.data(), buffer.data() + buffer.size());
+
+    EXPECT_EQ(result.ec, std::errc{});
+    EXPECT_EQ(result.ptr, buffer.data() + buffer.size());
+    EXPECT_EQ(buffer, toString(num));
+}
+
+TEST(BigUIntToChars, BufferTooShort) {
+    BigUInt num = createTestBigUInt({42, 1});
+    string buffer(decimalLength(num) - 1, '#');
+
+    std::to_chars_result result = toChars(num, buffer.data(), buffer.data() + buffer.size());
+
+    EXPECT_EQ(result.ec, std::errc::value_too_large);
+    EXPECT_EQ(result.ptr, buffer.data() + buffer.size());
+}
+
+TEST(BigUIntToChars, Zero) {
+    BigUInt num = createTestBigUInt({});
+    string buffer(3, '#');
+
+    std::to_chars_result result = toChars(num, buffer.data(), buffer.data() + buffer.size());
+
+    EXPECT_EQ(result.ec, std::errc{});
+    EXPECT_EQ(result.ptr, buffer.data() + 1);
+    EXPECT_EQ(buffer, "0##");
+}
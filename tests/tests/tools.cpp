@@ -7,3 +7,11 @@ using namespace big_uint;
 BigUInt createTestBigUInt(std::vector<Chunk> limbs) {
     return BigUInt(std::move(limbs));
 }
+
+BigUInt createPatternBigUInt(size_t size, Chunk step) {
+    std::vector<Chunk> limbs(size);
+    for (size_t i = 0; i < size; ++i) {
+        limbs[i] = MAX_VALUE - ((i * step) % MAX_VALUE);
+    }
+    return createTestBigUInt(std::move(limbs));
+}